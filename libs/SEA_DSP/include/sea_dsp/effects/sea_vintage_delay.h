@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../sea_delay_line.h"
+#include "../sea_denormal.h"
 #include "../sea_one_pole_filter.h"
 #include "../sea_sigmoid.h"
 #include "../sea_lfo.h"
@@ -85,8 +86,8 @@ public:
     feedback_r = Sigmoid<T>::SoftClipCubic(feedback_r);
 
     // Mix input with feedback and write to delay line
-    T delay_input_l = input_l + feedback_l;
-    T delay_input_r = input_r + feedback_r;
+    T delay_input_l = UndenormalState(input_l + feedback_l);
+    T delay_input_r = UndenormalState(input_r + feedback_r);
 
     delay_left_.Push(delay_input_l);
     delay_right_.Push(delay_input_r);
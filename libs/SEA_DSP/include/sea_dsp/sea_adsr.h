@@ -14,21 +14,65 @@
 
 namespace sea {
 
-class ADSREnvelope {
+/// Linear ADSR envelope. T is the level/coefficient type; ADSREnvelope is
+/// the platform-precision (sea::Real) instantiation.
+template <typename T = Real>
+class BasicADSREnvelope {
 public:
   enum Stage { kIdle, kAttack, kDecay, kSustain, kRelease };
 
-  ADSREnvelope() = default;
+  // Parameters plus their sample-rate dependent increments. An envelope owns
+  // one set (SetParams); the NoteOn/NoteOff/Process overloads taking a
+  // Coefficients instead read a set shared by many envelopes, so a patch
+  // change is computed once rather than once per voice.
+  struct Coefficients {
+    T a = static_cast<T>(0.01);
+    T d = static_cast<T>(0.1);
+    T s = static_cast<T>(0.5);
+    T r = static_cast<T>(0.2);
+    T attackInc = static_cast<T>(0.0);
+    T decayInc = static_cast<T>(0.0);
+    T releaseRecip = static_cast<T>(0.0); // 1/(R*SR)
 
-  void Init(Real sampleRate) {
+    static Coefficients Compute(T a, T d, T s, T r,
+                                T sampleRate) {
+      Coefficients c;
+      c.a = (a < static_cast<T>(0.0)) ? static_cast<T>(0.0) : a;
+      c.d = (d < static_cast<T>(0.0)) ? static_cast<T>(0.0) : d;
+      c.s = Math::Clamp(s, static_cast<T>(0.0), static_cast<T>(1.0));
+      c.r = (r < static_cast<T>(0.0)) ? static_cast<T>(0.0) : r;
+      c.UpdateIncrements(sampleRate);
+      return c;
+    }
+
+    void UpdateIncrements(T sampleRate) {
+      if (sampleRate > static_cast<T>(0.0)) {
+        attackInc = (a > static_cast<T>(0.0))
+                        ? (static_cast<T>(1.0) / (a * sampleRate))
+                        : static_cast<T>(0.0);
+        decayInc = (d > static_cast<T>(0.0))
+                       ? ((static_cast<T>(1.0) - s) / (d * sampleRate))
+                       : static_cast<T>(0.0);
+        // Pre-calculate reciprocal to avoid division in NoteOff
+        releaseRecip = (r > static_cast<T>(0.0))
+                           ? (static_cast<T>(1.0) / (r * sampleRate))
+                           : static_cast<T>(0.0);
+      }
+    }
+  };
+
+  BasicADSREnvelope() = default;
+
+  void Init(T sampleRate) {
     mSampleRate = sampleRate;
 #ifdef SEA_DSP_ADSR_BACKEND_DAISYSP
     mAdsr.Init(static_cast<float>(sampleRate));
     mGate = false;
-    SetParams(mA, mD, mS, mR);
+    SetParams(mCoeffs.a, mCoeffs.d, mCoeffs.s, mCoeffs.r);
     Reset();
 #else
-    CalculateCoefficients();
+    mCoeffs.UpdateIncrements(sampleRate);
+    mReleaseInc = mCoeffs.s * mCoeffs.releaseRecip;
     Reset();
 #endif
   }
@@ -37,43 +81,40 @@ public:
 #ifdef SEA_DSP_ADSR_BACKEND_DAISYSP
     mGate = false;
     mStage = kIdle;
-    mLevel = static_cast<Real>(0.0);
+    mLevel = static_cast<T>(0.0);
     mAdsr.Init(static_cast<float>(mSampleRate));
-    mAdsr.SetAttackTime(static_cast<float>(mA));
-    mAdsr.SetDecayTime(static_cast<float>(mD));
-    mAdsr.SetSustainLevel(static_cast<float>(mS));
-    mAdsr.SetReleaseTime(static_cast<float>(mR));
+    ApplyBackendParams();
 #else
     mStage = kIdle;
-    mLevel = static_cast<Real>(0.0);
+    mLevel = static_cast<T>(0.0);
 #endif
   }
 
-  void SetParams(Real a, Real d, Real s, Real r) {
-    mA = (a < static_cast<Real>(0.0)) ? static_cast<Real>(0.0) : a;
-    mD = (d < static_cast<Real>(0.0)) ? static_cast<Real>(0.0) : d;
-    mS = Math::Clamp(s, static_cast<Real>(0.0), static_cast<Real>(1.0));
-    mR = (r < static_cast<Real>(0.0)) ? static_cast<Real>(0.0) : r;
+  void SetParams(T a, T d, T s, T r) {
+    mCoeffs = Coefficients::Compute(a, d, s, r, mSampleRate);
 #ifdef SEA_DSP_ADSR_BACKEND_DAISYSP
-    mAdsr.SetAttackTime(static_cast<float>(mA));
-    mAdsr.SetDecayTime(static_cast<float>(mD));
-    mAdsr.SetSustainLevel(static_cast<float>(mS));
-    mAdsr.SetReleaseTime(static_cast<float>(mR));
+    ApplyBackendParams();
 #else
-    CalculateCoefficients();
+    mReleaseInc = mCoeffs.s * mCoeffs.releaseRecip; // Keep this for reference
 #endif
   }
 
-  void NoteOn() {
+  void NoteOn() { NoteOn(mCoeffs); }
+  void NoteOff() { NoteOff(mCoeffs); }
+  SEA_INLINE T Process() { return Process(mCoeffs); }
+
+  // Shared-coefficient variants (see Coefficients).
+  void NoteOn(const Coefficients &c) {
 #ifdef SEA_DSP_ADSR_BACKEND_DAISYSP
+    SyncBackendParams(c);
     mGate = true;
     mStage = kAttack;
 #else
-    if (mA == static_cast<Real>(0.0)) {
-      mLevel = static_cast<Real>(1.0);
-      mStage = (mD == static_cast<Real>(0.0)) ? kSustain : kDecay;
+    if (c.a == static_cast<T>(0.0)) {
+      mLevel = static_cast<T>(1.0);
+      mStage = (c.d == static_cast<T>(0.0)) ? kSustain : kDecay;
       if (mStage == kSustain) {
-        mLevel = mS;
+        mLevel = c.s;
       }
     } else {
       mStage = kAttack;
@@ -81,80 +122,82 @@ public:
 #endif
   }
 
-  void NoteOff() {
+  void NoteOff(const Coefficients &c) {
 #ifdef SEA_DSP_ADSR_BACKEND_DAISYSP
+    SyncBackendParams(c);
     if (mStage != kIdle) {
       mGate = false;
       mStage = kRelease;
     }
 #else
     if (mStage != kIdle) {
-      if (mR == static_cast<Real>(0.0)) {
-        mLevel = static_cast<Real>(0.0);
+      if (c.r == static_cast<T>(0.0)) {
+        mLevel = static_cast<T>(0.0);
         mStage = kIdle;
       } else {
         // Multiply instead of divide - much faster
-        mReleaseInc = mLevel * mReleaseRecip;
+        mReleaseInc = mLevel * c.releaseRecip;
         mStage = kRelease;
       }
     }
 #endif
   }
 
-  SEA_INLINE Real Process() {
+  SEA_INLINE T Process(const Coefficients &c) {
 #ifdef SEA_DSP_ADSR_BACKEND_DAISYSP
-    Real out = static_cast<Real>(mAdsr.Process(mGate));
-    mLevel = Math::Clamp(out, static_cast<Real>(0.0), static_cast<Real>(1.0));
+    SyncBackendParams(c);
+    T out = static_cast<T>(mAdsr.Process(mGate));
+    mLevel = Math::Clamp(out, static_cast<T>(0.0), static_cast<T>(1.0));
     UpdateStageFromBackend(mLevel);
     return mLevel;
 #else
     if (mStage == kIdle)
-      return static_cast<Real>(0.0);
+      return static_cast<T>(0.0);
 
     switch (mStage) {
     case kIdle:
       break;
     case kAttack:
-      if (mAttackInc <= static_cast<Real>(0.0)) {
-        mLevel = static_cast<Real>(1.0);
-        mStage = (mD == static_cast<Real>(0.0)) ? kSustain : kDecay;
+      if (c.attackInc <= static_cast<T>(0.0)) {
+        mLevel = static_cast<T>(1.0);
+        mStage = (c.d == static_cast<T>(0.0)) ? kSustain : kDecay;
         if (mStage == kSustain) {
-          mLevel = mS;
+          mLevel = c.s;
         }
       } else {
-        mLevel += mAttackInc;
-        if (mLevel >= static_cast<Real>(1.0) - static_cast<Real>(1e-9)) {
-          mLevel = static_cast<Real>(1.0);
-          mStage = (mD == static_cast<Real>(0.0)) ? kSustain : kDecay;
+        mLevel += c.attackInc;
+        if (mLevel >= static_cast<T>(1.0) - static_cast<T>(1e-9)) {
+          mLevel = static_cast<T>(1.0);
+          mStage = (c.d == static_cast<T>(0.0)) ? kSustain : kDecay;
           if (mStage == kSustain) {
-            mLevel = mS;
+            mLevel = c.s;
           }
         }
       }
       break;
     case kDecay:
-      if (mDecayInc <= static_cast<Real>(0.0)) {
-        mLevel = mS;
+      if (c.decayInc <= static_cast<T>(0.0)) {
+        mLevel = c.s;
         mStage = kSustain;
       } else {
-        mLevel -= mDecayInc;
-        if (mLevel <= mS + static_cast<Real>(1e-9)) {
-          mLevel = mS;
+        mLevel -= c.decayInc;
+        if (mLevel <= c.s + static_cast<T>(1e-9)) {
+          mLevel = c.s;
           mStage = kSustain;
         }
       }
       break;
     case kSustain:
-      mLevel = mS;
+      mLevel = c.s;
       break;
     case kRelease:
-      if (mReleaseInc <= static_cast<Real>(0.0)) {
-        mLevel = static_cast<Real>(0.0);
+      if (mReleaseInc <= static_cast<T>(0.0)) {
+        mLevel = static_cast<T>(0.0);
         mStage = kIdle;
       } else {
         mLevel -= mReleaseInc;
-        if (mLevel <= static_cast<Real>(1e-9)) {
-          mLevel = static_cast<Real>(0.0);
+        if (mLevel <= static_cast<T>(1e-9)) {
+          mLevel = static_cast<T>(0.0);
           mStage = kIdle;
         }
       }
@@ -164,13 +207,131 @@ public:
 #endif
   }
 
+  void ProcessBlock(T *out, int n) { ProcessBlock(mCoeffs, out, n); }
+
+  // n samples, identical to n calls of Process(c). Sustain and idle spans
+  // are a plain fill. A linear segment runs in spans that stop short of
+  // its end threshold, with no stage switch or threshold compare inside
+  // the span; only the samples around a stage boundary take the per-sample
+  // path.
+  void ProcessBlock(const Coefficients &c, T *out, int n) {
+#ifdef SEA_DSP_ADSR_BACKEND_DAISYSP
+    for (int i = 0; i < n; ++i)
+      out[i] = Process(c);
+#else
+    int i = 0;
+    while (i < n) {
+      int span = 0;
+      switch (mStage) {
+      case kIdle:
+        std::fill(out + i, out + n, static_cast<T>(0.0));
+        return;
+      case kSustain:
+        mLevel = c.s;
+        std::fill(out + i, out + n, c.s);
+        return;
+      case kAttack:
+        if (c.attackInc > static_cast<T>(0.0))
+          span = RampSpan<true>(out + i, n - i, c.attackInc,
+                                static_cast<T>(1.0) - static_cast<T>(1e-9));
+        break;
+      case kDecay:
+        if (c.decayInc > static_cast<T>(0.0))
+          span = RampSpan<false>(out + i, n - i, c.decayInc,
+                                 c.s + static_cast<T>(1e-9));
+        break;
+      case kRelease:
+        if (mReleaseInc > static_cast<T>(0.0))
+          span = RampSpan<false>(out + i, n - i, mReleaseInc,
+                                 static_cast<T>(1e-9));
+        break;
+      }
+      if (span > 0) {
+        i += span;
+      } else {
+        out[i++] = Process(c);
+      }
+    }
+#endif
+  }
+
+  void Advance(uint64_t numSamples) { Advance(mCoeffs, numSamples); }
+
+  // Skips numSamples Process(c) calls in time independent of numSamples
+  // (seeking, pre-roll): each linear segment is crossed in one step,
+  // landing on level + k * inc. Process() accumulates the same ramp one
+  // increment at a time, so the two agree to that rounding; a segment end
+  // that falls within rounding of the threshold can land one sample apart.
+  void Advance(const Coefficients &c, uint64_t numSamples) {
+#ifdef SEA_DSP_ADSR_BACKEND_DAISYSP
+    for (uint64_t i = 0; i < numSamples; ++i)
+      Process(c);
+#else
+    while (numSamples > 0) {
+      // Per-sample step toward the segment threshold and the distance to
+      // it, both positive while the segment is still running.
+      T rate = static_cast<T>(0.0);
+      T distance = static_cast<T>(0.0);
+      T sign = static_cast<T>(1.0);
+      switch (mStage) {
+      case kIdle:
+        return;
+      case kSustain:
+        mLevel = c.s;
+        return;
+      case kAttack:
+        rate = c.attackInc;
+        distance = static_cast<T>(1.0) - static_cast<T>(1e-9) - mLevel;
+        break;
+      case kDecay:
+        rate = c.decayInc;
+        distance = mLevel - c.s - static_cast<T>(1e-9);
+        sign = static_cast<T>(-1.0);
+        break;
+      case kRelease:
+        rate = mReleaseInc;
+        distance = mLevel - static_cast<T>(1e-9);
+        sign = static_cast<T>(-1.0);
+        break;
+      }
+      if (rate <= static_cast<T>(0.0)) {
+        // Zero-length segment: Process() ends it on the first sample.
+        Process(c);
+        --numSamples;
+        continue;
+      }
+      // Samples until Process() would end the segment, counting the sample
+      // that crosses the threshold (at least one).
+      const T toEnd = std::ceil(distance / rate);
+      if (toEnd > static_cast<T>(numSamples)) {
+        mLevel += sign * static_cast<T>(numSamples) * rate;
+        return;
+      }
+      const uint64_t steps =
+          toEnd > static_cast<T>(1.0) ? static_cast<uint64_t>(toEnd) : 1u;
+      numSamples -= steps;
+      EndSegment(c);
+    }
+#endif
+  }
+
   bool IsActive() const { return mStage != kIdle; }
-  Real GetLevel() const { return mLevel; }
+  T GetLevel() const { return mLevel; }
   Stage GetStage() const { return mStage; }
 
+#ifndef SEA_DSP_ADSR_BACKEND_DAISYSP
+  // Raw segment state (for ADSRLanes to gather/scatter).
+  T GetReleaseInc() const { return mReleaseInc; }
+  void SetState(Stage stage, T level, T releaseInc) {
+    mStage = stage;
+    mLevel = level;
+    mReleaseInc = releaseInc;
+  }
+#endif
+
 private:
 #ifdef SEA_DSP_ADSR_BACKEND_DAISYSP
-  void UpdateStageFromBackend(Real out) {
+  void UpdateStageFromBackend(T out) {
     uint8_t seg = mAdsr.GetCurrentSegment();
     if (!mAdsr.IsRunning() && !mGate) {
       mStage = kIdle;
@@ -180,8 +341,8 @@ private:
       if (seg == daisysp::ADSR_SEG_ATTACK) {
         mStage = kAttack;
       } else if (seg == daisysp::ADSR_SEG_DECAY) {
-        Real eps = static_cast<Real>(0.005);
-        mStage = (Math::Abs(out - mS) <= eps) ? kSustain : kDecay;
+        T eps = static_cast<T>(0.005);
+        mStage = (Math::Abs(out - mCoeffs.s) <= eps) ? kSustain : kDecay;
       } else {
         mStage = kSustain;
       }
@@ -189,41 +350,95 @@ private:
       mStage = mAdsr.IsRunning() ? kRelease : kIdle;
     }
   }
+
+  void ApplyBackendParams() {
+    mAdsr.SetAttackTime(static_cast<float>(mCoeffs.a));
+    mAdsr.SetDecayTime(static_cast<float>(mCoeffs.d));
+    mAdsr.SetSustainLevel(static_cast<float>(mCoeffs.s));
+    mAdsr.SetReleaseTime(static_cast<float>(mCoeffs.r));
+  }
+
+  // DaisySP keeps its own per-envelope state: adopt shared parameters
+  // whenever they differ from the ones last applied.
+  void SyncBackendParams(const Coefficients &c) {
+    if (&c == &mCoeffs)
+      return;
+    if (c.a != mCoeffs.a || c.d != mCoeffs.d || c.s != mCoeffs.s ||
+        c.r != mCoeffs.r) {
+      mCoeffs = c;
+      ApplyBackendParams();
+    }
+  }
 #else
-  void CalculateCoefficients() {
-    if (mSampleRate > static_cast<Real>(0.0)) {
-      mAttackInc = (mA > static_cast<Real>(0.0))
-                       ? (static_cast<Real>(1.0) / (mA * mSampleRate))
-                       : static_cast<Real>(0.0);
-      mDecayInc = (mD > static_cast<Real>(0.0))
-                      ? ((static_cast<Real>(1.0) - mS) / (mD * mSampleRate))
-                      : static_cast<Real>(0.0);
-      // Pre-calculate reciprocal to avoid division in NoteOff
-      mReleaseRecip = (mR > static_cast<Real>(0.0))
-                          ? (static_cast<Real>(1.0) / (mR * mSampleRate))
-                          : static_cast<Real>(0.0);
-      mReleaseInc = mS * mReleaseRecip; // Keep this for reference
+  // The stage change and level Process() applies when a segment reaches its
+  // threshold.
+  void EndSegment(const Coefficients &c) {
+    switch (mStage) {
+    case kAttack:
+      mLevel = static_cast<T>(1.0);
+      mStage = (c.d == static_cast<T>(0.0)) ? kSustain : kDecay;
+      if (mStage == kSustain)
+        mLevel = c.s;
+      break;
+    case kDecay:
+      mLevel = c.s;
+      mStage = kSustain;
+      break;
+    case kRelease:
+      mLevel = static_cast<T>(0.0);
+      mStage = kIdle;
+      break;
+    default:
+      break;
     }
   }
+
+  // Runs up to n samples of the current linear segment (mLevel += or -=
+  // inc, exactly as Process() does) that stay short of `threshold`, the
+  // level at which Process() would end the segment. The span length is
+  // estimated from the remaining distance; accumulated rounding can make
+  // the estimate optimistic, so the span is checked once at the end (the
+  // ramp is monotonic) and retried at half length if it crossed. Returns
+  // 0 when fewer than kMinRampSpan samples are safe, leaving mLevel as is.
+  template <bool kRising>
+  int RampSpan(T *out, int n, T inc, T threshold) {
+    constexpr int kMinRampSpan = 4;
+    const T distance = kRising ? threshold - mLevel : mLevel - threshold;
+    const T estimate = distance / inc - static_cast<T>(2.0);
+    int span = (estimate >= static_cast<T>(n)) ? n
+               : (estimate > static_cast<T>(0.0)) ? static_cast<int>(estimate)
+                                                 : 0;
+    for (; span >= kMinRampSpan; span /= 2) {
+      T level = mLevel;
+      for (int i = 0; i < span; ++i) {
+        if constexpr (kRising)
+          level += inc;
+        else
+          level -= inc;
+        out[i] = level;
+      }
+      const bool crossed = kRising ? level >= threshold : level <= threshold;
+      if (!crossed) {
+        mLevel = level;
+        return span;
+      }
+    }
+    return 0;
+  }
 #endif
 
-  Real mSampleRate = static_cast<Real>(44100.0);
+  T mSampleRate = static_cast<T>(44100.0);
   Stage mStage = kIdle;
-  Real mLevel = static_cast<Real>(0.0);
-
-  Real mA = static_cast<Real>(0.01);
-  Real mD = static_cast<Real>(0.1);
-  Real mS = static_cast<Real>(0.5);
-  Real mR = static_cast<Real>(0.2);
+  T mLevel = static_cast<T>(0.0);
 
-  Real mAttackInc = static_cast<Real>(0.0);
-  Real mDecayInc = static_cast<Real>(0.0);
-  Real mReleaseInc = static_cast<Real>(0.0);
-  Real mReleaseRecip = static_cast<Real>(0.0); // Pre-calculated 1/(R*SR)
+  Coefficients mCoeffs;
+  T mReleaseInc = static_cast<T>(0.0);
 #ifdef SEA_DSP_ADSR_BACKEND_DAISYSP
   bool mGate = false;
   daisysp::Adsr mAdsr;
 #endif
 };
 
+using ADSREnvelope = BasicADSREnvelope<Real>;
+
 } // namespace sea
@@ -0,0 +1,164 @@
+#pragma once
+#include "sea_adsr.h"
+#include "sea_simd.h"
+
+#ifdef SEA_DSP_ADSR_BACKEND_DAISYSP
+#error "ADSRLanes needs the sea_core ADSR backend"
+#endif
+
+namespace sea {
+
+/// Lanes linear ADSR envelopes run side by side, one per voice, sharing one
+/// Coefficients set. ProcessBlock() produces, per lane, exactly the values
+/// of n BasicADSREnvelope::Process(c) calls: spans in which no lane reaches
+/// the end of its segment run as one fixed-width add per sample over the
+/// lane arrays (see sea_simd.h), and only the samples around a stage
+/// boundary step each lane through Process().
+///
+/// As with LadderFilterLanes the state stays with each envelope: Load()
+/// gathers it at the start of a block and Store() scatters it back.
+template <typename T, int Lanes> class ADSRLanes {
+public:
+  using Envelope = BasicADSREnvelope<T>;
+  using Coefficients = typename Envelope::Coefficients;
+  using Stage = typename Envelope::Stage;
+  static constexpr int kLanes = Lanes;
+
+  ADSRLanes() { Reset(); }
+
+  /// Every lane idle at level 0.
+  void Reset() {
+    for (int l = 0; l < Lanes; ++l) {
+      mStage[l] = Envelope::kIdle;
+      mLevel[l] = static_cast<T>(0.0);
+      mReleaseInc[l] = static_cast<T>(0.0);
+      mIdleFrom[l] = 0;
+    }
+  }
+
+  void Load(int lane, const Envelope &env) {
+    mStage[lane] = env.GetStage();
+    mLevel[lane] = env.GetLevel();
+    mReleaseInc[lane] = env.GetReleaseInc();
+  }
+
+  void Store(int lane, Envelope &env) const {
+    env.SetState(mStage[lane], mLevel[lane], mReleaseInc[lane]);
+  }
+
+  /// n samples of every lane, lane-interleaved: out[i * Lanes + l].
+  void ProcessBlock(const Coefficients &c, T *SEA_RESTRICT out, int n) {
+    for (int l = 0; l < Lanes; ++l)
+      mIdleFrom[l] = (mStage[l] == Envelope::kIdle) ? 0 : n;
+    int i = 0;
+    while (i < n) {
+      const int span = RampSpan(c, out + i * Lanes, n - i);
+      if (span > 0) {
+        i += span;
+        continue;
+      }
+      for (int l = 0; l < Lanes; ++l) {
+        Envelope env;
+        Store(l, env);
+        out[i * Lanes + l] = env.Process(c);
+        Load(l, env);
+        if (mStage[l] == Envelope::kIdle && mIdleFrom[l] == n)
+          mIdleFrom[l] = i;
+      }
+      ++i;
+    }
+  }
+
+  /// First sample of the last ProcessBlock() after which the lane was idle
+  /// (0 if it started idle), or n if it is still running.
+  int GetIdleFrom(int lane) const { return mIdleFrom[lane]; }
+
+private:
+  // Runs up to n samples in which every ramping lane stays short of the
+  // level at which Process() would end its segment, the lanes' spans
+  // estimated and checked as in BasicADSREnvelope::RampSpan(). Sustain
+  // lanes hold c.s and idle lanes output 0. Returns 0 when fewer than
+  // kMinRampSpan samples are safe, leaving the state as is.
+  int RampSpan(const Coefficients &c, T *SEA_RESTRICT out, int n) {
+    constexpr int kMinRampSpan = 4;
+    constexpr T kEpsilon = static_cast<T>(1e-9);
+    alignas(simd::kAlignment) T start[Lanes];
+    alignas(simd::kAlignment) T step[Lanes];
+    T threshold[Lanes] = {};
+    int direction[Lanes]; // +1 rising, -1 falling, 0 holding
+    int span = n;
+    for (int l = 0; l < Lanes; ++l) {
+      T inc = static_cast<T>(0.0);
+      start[l] = mLevel[l];
+      step[l] = static_cast<T>(0.0);
+      direction[l] = 0;
+      switch (mStage[l]) {
+      case Envelope::kIdle:
+        start[l] = static_cast<T>(0.0);
+        continue;
+      case Envelope::kSustain:
+        start[l] = c.s;
+        continue;
+      case Envelope::kAttack:
+        inc = c.attackInc;
+        threshold[l] = static_cast<T>(1.0) - kEpsilon;
+        direction[l] = 1;
+        break;
+      case Envelope::kDecay:
+        inc = c.decayInc;
+        threshold[l] = c.s + kEpsilon;
+        direction[l] = -1;
+        break;
+      case Envelope::kRelease:
+        inc = mReleaseInc[l];
+        threshold[l] = kEpsilon;
+        direction[l] = -1;
+        break;
+      }
+      if (inc <= static_cast<T>(0.0))
+        return 0;
+      // level -= inc is level + (-inc) exactly, so falling lanes add too.
+      step[l] = direction[l] > 0 ? inc : -inc;
+      const T distance = direction[l] > 0 ? threshold[l] - mLevel[l]
+                                          : mLevel[l] - threshold[l];
+      const T estimate = distance / inc - static_cast<T>(2.0);
+      const int laneSpan =
+          (estimate >= static_cast<T>(span)) ? span
+          : (estimate > static_cast<T>(0.0)) ? static_cast<int>(estimate)
+                                              : 0;
+      span = laneSpan < span ? laneSpan : span;
+    }
+
+    alignas(simd::kAlignment) T level[Lanes];
+    for (; span >= kMinRampSpan; span /= 2) {
+      for (int l = 0; l < Lanes; ++l)
+        level[l] = start[l];
+      for (int i = 0; i < span; ++i) {
+        for (int l = 0; l < Lanes; ++l) {
+          level[l] += step[l];
+          out[i * Lanes + l] = level[l];
+        }
+      }
+      bool crossed = false;
+      for (int l = 0; l < Lanes; ++l) {
+        crossed |= (direction[l] > 0 && level[l] >= threshold[l]) ||
+                   (direction[l] < 0 && level[l] <= threshold[l]);
+      }
+      if (!crossed) {
+        for (int l = 0; l < Lanes; ++l) {
+          if (mStage[l] != Envelope::kIdle)
+            mLevel[l] = level[l];
+        }
+        return span;
+      }
+    }
+    return 0;
+  }
+
+  Stage mStage[Lanes];
+  alignas(simd::kAlignment) T mLevel[Lanes];
+  alignas(simd::kAlignment) T mReleaseInc[Lanes];
+  int mIdleFrom[Lanes];
+};
+
+} // namespace sea
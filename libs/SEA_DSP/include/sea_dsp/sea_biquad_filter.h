@@ -1,4 +1,7 @@
 #pragma once
+#include "sea_coefficient_ramp.h"
+#include "sea_cutoff_table.h"
+#include "sea_denormal.h"
 #include "sea_math.h"
 #include "sea_platform.h"
 #include <algorithm>
@@ -9,6 +12,22 @@ enum class FilterType { LowPass, HighPass, BandPass, Notch };
 
 template <typename T> class BiquadFilter {
 public:
+  // Normalised direct-form coefficients (feed-forward a0..a2, feedback b1, b2).
+  struct Coefficients {
+    T a0;
+    T a1;
+    T a2;
+    T b1;
+    T b2;
+
+    static Coefficients Lerp(const Coefficients &a, const Coefficients &b,
+                             T t) {
+      return {a.a0 + (b.a0 - a.a0) * t, a.a1 + (b.a1 - a.a1) * t,
+              a.a2 + (b.a2 - a.a2) * t, a.b1 + (b.b1 - a.b1) * t,
+              a.b2 + (b.b2 - a.b2) * t};
+    }
+  };
+
   BiquadFilter() = default;
 
   void Init(T sampleRate) {
@@ -27,36 +46,98 @@ public:
 
   void SetParams(FilterType type, T cutoff, T Q) {
     mType = type;
+    StoreParams(cutoff, Q);
+    CalculateCoefficients();
+  }
 
-    // ClampCutoff
-    if (mSampleRate <= static_cast<T>(0.0)) {
-      mCutoff = static_cast<T>(0.0);
-    } else {
+  // Coefficients SetParams(type, cutoff, Q) would produce, without applying
+  // them. Pair with SetCoefficients() to ramp between targets.
+  Coefficients ComputeCoefficients(FilterType type, T cutoff, T Q) const {
+    T fc = static_cast<T>(0.0);
+    if (mSampleRate > static_cast<T>(0.0)) {
       T nyquist = static_cast<T>(0.5) * mSampleRate;
       T maxCutoff = nyquist * static_cast<T>(0.95);
-      mCutoff = Math::Clamp(cutoff, static_cast<T>(0.0), maxCutoff);
+      fc = Math::Clamp(cutoff, static_cast<T>(0.0), maxCutoff);
     }
+    T q = (Q < static_cast<T>(0.5)) ? static_cast<T>(0.5) : Q;
+    return DesignCoefficients(type, fc, q);
+  }
 
-    mQ = (Q < static_cast<T>(0.5)) ? static_cast<T>(0.5) : Q;
-    CalculateCoefficients();
+  // Reads tan(w/2) from a shared table instead of calling Sin/Cos (nullptr
+  // = exact). The table must outlive the filter and match its sample rate.
+  void SetCutoffTable(const CutoffTable<T> *table) { mCutoffTable = table; }
+
+  void SetCoefficients(const Coefficients &c) {
+    a0 = c.a0;
+    a1 = c.a1;
+    a2 = c.a2;
+    b1 = c.b1;
+    b2 = c.b2;
   }
 
   SEA_INLINE T Process(T in) {
     T out = in * a0 + z1;
-    z1 = in * a1 + z2 - b1 * out;
-    z2 = in * a2 - b2 * out;
+    z1 = UndenormalState(in * a1 + z2 - b1 * out);
+    z2 = UndenormalState(in * a2 - b2 * out);
     return out;
   }
 
+  // Filters n samples while the coefficients ramp from `from` to `to` (see
+  // ProcessRamped()). rampPos/rampLength split one ramp over several calls.
+  void ProcessBlock(const T *in, T *out, int n, const Coefficients &from,
+                    const Coefficients &to, int rampPos = 0,
+                    int rampLength = 0) {
+    ProcessRamped(
+        in, out, n, from, to, rampPos, rampLength,
+        [this](const Coefficients &c) { SetCoefficients(c); },
+        [this](T x) { return Process(x); });
+  }
+
+  // Filters n samples with the current type while the cutoff moves from
+  // cutoffStart to cutoffEnd: coefficients are designed at the two ends only
+  // and interpolated in between. A constant cutoff is SetParams() followed
+  // by per-sample Process().
+  void ProcessBlock(const T *in, T *out, int n, T cutoffStart, T cutoffEnd,
+                    T Q) {
+    if (cutoffStart == cutoffEnd) {
+      SetParams(mType, cutoffEnd, Q);
+      for (int i = 0; i < n; ++i)
+        out[i] = Process(in[i]);
+      return;
+    }
+    ProcessBlock(in, out, n, ComputeCoefficients(mType, cutoffStart, Q),
+                 ComputeCoefficients(mType, cutoffEnd, Q));
+    StoreParams(cutoffEnd, Q);
+  }
+
 private:
+  void StoreParams(T cutoff, T Q) {
+    // ClampCutoff
+    if (mSampleRate <= static_cast<T>(0.0)) {
+      mCutoff = static_cast<T>(0.0);
+    } else {
+      T nyquist = static_cast<T>(0.5) * mSampleRate;
+      T maxCutoff = nyquist * static_cast<T>(0.95);
+      mCutoff = Math::Clamp(cutoff, static_cast<T>(0.0), maxCutoff);
+    }
+
+    mQ = (Q < static_cast<T>(0.5)) ? static_cast<T>(0.5) : Q;
+  }
+
   void CalculateCoefficients() {
     if (mSampleRate == static_cast<T>(0.0))
       return;
+    SetCoefficients(DesignCoefficients(mType, mCutoff, mQ));
+  }
+
+  Coefficients DesignCoefficients(FilterType type, T cutoff, T Q) const {
+    if (mCutoffTable)
+      return DesignFromTan(type, mCutoffTable->Lookup(cutoff), Q);
 
-    T omega = static_cast<T>(kTwoPi) * mCutoff * mInvSampleRate;
+    T omega = static_cast<T>(kTwoPi) * cutoff * mInvSampleRate;
     T sn = Math::Sin(omega);
     T cs = Math::Cos(omega);
-    T alpha = sn / (static_cast<T>(2.0) * mQ);
+    T alpha = sn / (static_cast<T>(2.0) * Q);
 
     T b0_tmp = static_cast<T>(0.0);
     T b1_tmp = static_cast<T>(0.0);
@@ -68,7 +149,7 @@ private:
     T one = static_cast<T>(1.0);
     T two = static_cast<T>(2.0);
 
-    switch (mType) {
+    switch (type) {
     case FilterType::LowPass:
       b0_tmp = (one - cs) / two;
       b1_tmp = one - cs;
@@ -113,13 +194,43 @@ private:
 
     // Normalize
     T invA0 = one / a0_tmp;
-    a0 = b0_tmp * invA0;
-    a1 = b1_tmp * invA0;
-    a2 = b2_tmp * invA0;
-    b1 = a1_tmp * invA0;
-    b2 = a2_tmp * invA0;
+    return {b0_tmp * invA0, b1_tmp * invA0, b2_tmp * invA0, a1_tmp * invA0,
+            a2_tmp * invA0};
+  }
+
+  // The same responses in t = tan(w/2): sin w = 2t/(1+t^2) and
+  // cos w = (1-t^2)/(1+t^2), so scaling every term by (1+t^2) leaves
+  // a0 = D = 1 + t/Q + t^2 as the only divisor.
+  static Coefficients DesignFromTan(FilterType type, T t, T Q) {
+    const T one = static_cast<T>(1.0);
+    const T two = static_cast<T>(2.0);
+    const T zero = static_cast<T>(0.0);
+    const T t2 = t * t;
+    const T tq = t / Q;
+    const T invD = one / (one + tq + t2);
+    const T b1c = two * (t2 - one) * invD;
+    const T b2c = (one - tq + t2) * invD;
+    switch (type) {
+    case FilterType::LowPass: {
+      const T a = t2 * invD;
+      return {a, two * a, a, b1c, b2c};
+    }
+    case FilterType::HighPass:
+      return {invD, -two * invD, invD, b1c, b2c};
+    case FilterType::BandPass: {
+      const T a = tq * invD;
+      return {a, zero, -a, b1c, b2c};
+    }
+    case FilterType::Notch: {
+      const T a = (one + t2) * invD;
+      return {a, b1c, a, b1c, b2c};
+    }
+    default: // Pass through
+      return {one, zero, zero, zero, zero};
+    }
   }
 
+  const CutoffTable<T> *mCutoffTable = nullptr;
   T mSampleRate = static_cast<T>(44100.0);
   T mInvSampleRate = static_cast<T>(1.0) / static_cast<T>(44100.0);
   FilterType mType = FilterType::LowPass;
@@ -8,6 +8,17 @@ template <typename T> class CascadeFilter {
 public:
   enum class Slope { dB12, dB24 };
 
+  struct Coefficients {
+    typename SVFilter<T>::Coefficients stage;
+    T feedbackGain;
+
+    static Coefficients Lerp(const Coefficients &a, const Coefficients &b,
+                             T t) {
+      return {SVFilter<T>::Coefficients::Lerp(a.stage, b.stage, t),
+              a.feedbackGain + (b.feedbackGain - a.feedbackGain) * t};
+    }
+  };
+
   CascadeFilter() = default;
 
   void Init(T sampleRate) {
@@ -33,6 +44,33 @@ public:
     UpdateStages();
   }
 
+  // Slope used by the ProcessBlock() overloads (coefficients do not depend
+  // on it).
+  void SetSlope(Slope slope) { mSlope = slope; }
+
+  // Coefficients SetParams(cutoff, resonance, ...) would produce, without
+  // applying them. Pair with SetCoefficients() to ramp between targets.
+  Coefficients ComputeCoefficients(T cutoff, T resonance) const {
+    T fc = Math::Clamp(cutoff, static_cast<T>(20.0), static_cast<T>(20000.0));
+    T res = Math::Clamp(resonance, static_cast<T>(0.0), static_cast<T>(1.0));
+    T q = static_cast<T>(0.5) + res * static_cast<T>(9.5);
+    q = Math::Clamp(q, static_cast<T>(0.5), static_cast<T>(12.0));
+    return {stage1.ComputeCoefficients(fc, q), res * static_cast<T>(1.6)};
+  }
+
+  // See TPTIntegrator::SetCutoffTable().
+  void SetCutoffTable(const CutoffTable<T> *table) {
+    stage1.SetCutoffTable(table);
+    stage2.SetCutoffTable(table);
+  }
+
+  void SetCoefficients(const Coefficients &c, Slope slope) {
+    mSlope = slope;
+    stage1.SetCoefficients(c.stage);
+    stage2.SetCoefficients(c.stage);
+    mFeedbackGain = c.feedbackGain;
+  }
+
   SEA_INLINE T Process(T in) {
     T feedback = (mSlope == Slope::dB24) ? mLastOut24 : mLastOut12;
     // Per-sample tanh: nonlinear waveshaping, input varies per sample
@@ -47,15 +85,36 @@ public:
     return (mSlope == Slope::dB24) ? out2 : out1;
   }
 
-private:
-  void UpdateStages() {
-    T q = static_cast<T>(0.5) + mResonance * static_cast<T>(9.5);
-    q = Math::Clamp(q, static_cast<T>(0.5), static_cast<T>(12.0));
+  // Filters n samples at the current slope while the coefficients ramp from
+  // `from` to `to` (see ProcessRamped()).
+  void ProcessBlock(const T *in, T *out, int n, const Coefficients &from,
+                    const Coefficients &to, int rampPos = 0,
+                    int rampLength = 0) {
+    ProcessRamped(
+        in, out, n, from, to, rampPos, rampLength,
+        [this](const Coefficients &c) { SetCoefficients(c, mSlope); },
+        [this](T x) { return Process(x); });
+  }
 
-    stage1.SetParams(mCutoff, q);
-    stage2.SetParams(mCutoff, q);
+  // Filters n samples at the current slope while the cutoff ramps from
+  // cutoffStart to cutoffEnd. A constant cutoff is SetParams() followed by
+  // per-sample Process().
+  void ProcessBlock(const T *in, T *out, int n, T cutoffStart, T cutoffEnd,
+                    T resonance) {
+    if (cutoffStart == cutoffEnd) {
+      SetParams(cutoffEnd, resonance, mSlope);
+      for (int i = 0; i < n; ++i)
+        out[i] = Process(in[i]);
+      return;
+    }
+    ProcessBlock(in, out, n, ComputeCoefficients(cutoffStart, resonance),
+                 ComputeCoefficients(cutoffEnd, resonance));
+  }
 
-    mFeedbackGain = mResonance * static_cast<T>(1.6);
+private:
+  // Both stages share one set of coefficients: compute them once.
+  void UpdateStages() {
+    SetCoefficients(ComputeCoefficients(mCutoff, mResonance), mSlope);
   }
 
   T mSampleRate = static_cast<T>(44100.0);
@@ -2,34 +2,47 @@
 #include "sea_svf.h"
 #include <algorithm>
 #include <cmath>
-#include <vector>
 #include "sea_math.h"
 
 namespace sea {
 
-template <typename T> class ClassicalFilter {
+/// Cascade of SVF low-pass sections (one per pole pair) realising a
+/// Butterworth or Chebyshev response of order 2..MaxOrder. Stage storage is
+/// a fixed in-object array, so SetConfig() can change order or type on the
+/// audio thread without allocating.
+template <typename T, int MaxOrder = 8> class ClassicalFilter {
 public:
+  static_assert(MaxOrder >= 2 && MaxOrder % 2 == 0,
+                "MaxOrder must be a positive even number");
+
   enum class Type { Butterworth, Chebyshev1, Chebyshev2 };
 
+  static constexpr int kMaxOrder = MaxOrder;
+  static constexpr int kMaxStages = MaxOrder / 2;
+
   ClassicalFilter() = default;
 
   void Init(T sampleRate) {
     mSampleRate = sampleRate;
-    for (auto &f : stages)
-      f.Init(sampleRate);
+    for (int i = 0; i < mNumStages; ++i)
+      mStages[i].Init(sampleRate);
     Reset();
   }
 
   void Reset() {
-    for (auto &f : stages)
-      f.Reset();
+    for (int i = 0; i < mNumStages; ++i)
+      mStages[i].Reset();
   }
 
+  // Order is rounded up to even and clamped to [2, MaxOrder]. Realtime-safe;
+  // the active stages restart from zero state.
   void SetConfig(Type type, int order, T rippleDb) {
     mType = type;
     mOrder = (order < 2) ? 2 : order;
     if (mOrder % 2 != 0)
       mOrder += 1;
+    if (mOrder > MaxOrder)
+      mOrder = MaxOrder;
 
     mRippleDb =
         (rippleDb < static_cast<T>(0.01)) ? static_cast<T>(0.01) : rippleDb;
@@ -46,26 +59,42 @@ public:
       mCutoff = Math::Clamp(cutoff, static_cast<T>(0.0), maxCutoff);
     }
 
-    for (size_t i = 0; i < stages.size(); ++i) {
-      stages[i].SetParams(mCutoff, mQFactors[i]);
+    for (int i = 0; i < mNumStages; ++i) {
+      mStages[i].SetParams(mCutoff, mQFactors[i]);
     }
   }
 
+  int GetOrder() const { return mOrder; }
+
   SEA_INLINE T Process(T in) {
     T out = in;
-    for (auto &stage : stages) {
-      out = stage.ProcessLP(out);
+    for (int i = 0; i < mNumStages; ++i) {
+      out = mStages[i].ProcessLP(out);
     }
     return out;
   }
 
+  // n samples through the whole cascade, one stage at a time so each
+  // stage's state stays in registers for the block. Same output as
+  // per-sample Process(); in and out may be the same buffer.
+  void ProcessBlock(const T *in, T *out, int n) {
+    if (mNumStages == 0) {
+      std::copy(in, in + n, out);
+      return;
+    }
+    for (int i = 0; i < n; ++i)
+      out[i] = mStages[0].ProcessLP(in[i]);
+    for (int s = 1; s < mNumStages; ++s) {
+      SVFilter<T> &stage = mStages[s];
+      for (int i = 0; i < n; ++i)
+        out[i] = stage.ProcessLP(out[i]);
+    }
+  }
+
 private:
   void CalculatePoles() {
-    // TODO: Optimize for embedded (remove allocation)
-    stages.clear();
-    mQFactors.clear();
-
     int numPairs = mOrder / 2;
+    mNumStages = 0;
 
     if (mType == Type::Butterworth || mType == Type::Chebyshev2) {
       for (int k = 1; k <= numPairs; ++k) {
@@ -73,8 +102,7 @@ private:
                    static_cast<T>(mOrder) - static_cast<T>(1.0)) *
                   static_cast<T>(kPi) / (static_cast<T>(2.0) * static_cast<T>(mOrder));
         T q = static_cast<T>(-1.0) / (static_cast<T>(2.0) * Math::Cos(angle));
-        mQFactors.push_back(q);
-        stages.emplace_back();
+        mQFactors[mNumStages++] = q;
       }
     } else if (mType == Type::Chebyshev1) {
       T eps = Math::Sqrt(
@@ -100,15 +128,14 @@ private:
         T mag = Math::Sqrt(mag2);
         T q = mag / (static_cast<T>(-2.0) * re);
 
-        mQFactors.push_back(q);
-        stages.emplace_back();
+        mQFactors[mNumStages++] = q;
       }
     }
 
     // Initialize the new stages
-    for (size_t i = 0; i < stages.size(); ++i) {
-      stages[i].Init(mSampleRate);
-      stages[i].SetParams(mCutoff, mQFactors[i]);
+    for (int i = 0; i < mNumStages; ++i) {
+      mStages[i].Init(mSampleRate);
+      mStages[i].SetParams(mCutoff, mQFactors[i]);
     }
   }
 
@@ -118,9 +145,10 @@ private:
   T mRippleDb = static_cast<T>(1.0);
   T mCutoff = static_cast<T>(1000.0);
 
-  // TODO: Optimize for embedded (remove allocation)
-  std::vector<SVFilter<T>> stages;
-  std::vector<T> mQFactors;
+  // Stages [0, mNumStages) are active (0 until the first SetConfig()).
+  SVFilter<T> mStages[kMaxStages];
+  T mQFactors[kMaxStages] = {};
+  int mNumStages = 0;
 };
 
 } // namespace sea
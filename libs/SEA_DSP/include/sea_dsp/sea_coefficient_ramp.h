@@ -0,0 +1,26 @@
+#pragma once
+#include "sea_platform.h"
+
+namespace sea {
+
+/// Shared loop behind the filters' ramped ProcessBlock(). Sample i applies
+/// Coefficients::Lerp(from, to, t) with t = (rampPos + i + 1) / rampLength
+/// and then filters in[i], so a ramp lands exactly on `to` at its last
+/// sample and may be split across several calls (rampPos counts the samples
+/// already done). rampLength <= 0 ramps over exactly these n samples.
+template <typename T, typename Coefficients, typename Apply, typename Tick>
+SEA_INLINE void ProcessRamped(const T *in, T *out, int n,
+                              const Coefficients &from, const Coefficients &to,
+                              int rampPos, int rampLength, Apply apply,
+                              Tick tick) {
+  if (rampLength <= 0)
+    rampLength = n;
+  const T invLength = static_cast<T>(1.0) / static_cast<T>(rampLength);
+  for (int i = 0; i < n; ++i) {
+    apply(Coefficients::Lerp(from, to,
+                             static_cast<T>(rampPos + i + 1) * invLength));
+    out[i] = tick(in[i]);
+  }
+}
+
+} // namespace sea
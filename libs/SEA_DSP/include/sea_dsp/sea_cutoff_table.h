@@ -0,0 +1,107 @@
+#pragma once
+#include "sea_platform.h"
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace sea {
+
+/// tan(pi * fc / fs) for one sample rate: the prewarped bilinear gain that
+/// every filter model derives its cutoff coefficients from (the TPT/ladder
+/// g, and tan(w/2) for the biquad). Resonance terms are plain arithmetic
+/// and stay exact in the filters, so a single cutoff axis serves them all.
+///
+/// Entries are kPointsPerOctave per octave, evenly spaced in Hz within each
+/// octave, so the index comes straight from the exponent and mantissa bits
+/// of the cutoff (no log call) and a lookup is one interpolated read.
+/// Covers sample rates up to 384 kHz. Init() costs ~1000 std::tan calls;
+/// build it once per sample rate outside the audio thread and share it
+/// between voices (filters hold a pointer, see SetCutoffTable()).
+template <typename T> class CutoffTable {
+public:
+  static constexpr int kMinExponent = 3; // 8 Hz
+  static constexpr int kOctaves = 15;    // up to 2^18 Hz
+  static constexpr int kPointsPerOctave = 64;
+  static constexpr int kSize = kOctaves * kPointsPerOctave + 1;
+
+  CutoffTable() = default;
+
+  void Init(T sampleRate) {
+    mSampleRate = sampleRate;
+    // Filters clamp their cutoff at or below 0.475 fs; entries past that
+    // stay finite so interpolation next to the clamp is well defined.
+    const double fs = static_cast<double>(sampleRate);
+    const double maxCutoff = 0.49 * fs;
+    constexpr double kPiD = 3.14159265358979323846;
+    for (int i = 0; i < kSize; ++i) {
+      const int octave = i / kPointsPerOctave;
+      const double step = static_cast<double>(i % kPointsPerOctave) /
+                          static_cast<double>(kPointsPerOctave);
+      double fc = std::ldexp(1.0 + step, kMinExponent + octave);
+      if (fc > maxCutoff)
+        fc = maxCutoff;
+      mTable[i] = fs > 0.0 ? static_cast<T>(std::tan(kPiD * fc / fs)) : T(0);
+    }
+  }
+
+  T GetSampleRate() const { return mSampleRate; }
+
+  /// tan(pi * cutoff / fs), linearly interpolated. cutoff must already be
+  /// clamped below Nyquist; below 8 Hz tan is linear and scales exactly.
+  SEA_INLINE T Lookup(T cutoff) const {
+    constexpr T kMin = static_cast<T>(1 << kMinExponent);
+    if (!(cutoff > kMin))
+      return cutoff > static_cast<T>(0.0) ? mTable[0] * (cutoff / kMin)
+                                          : static_cast<T>(0.0);
+    int index;
+    T frac;
+    Position(cutoff, index, frac);
+    if (index >= kSize - 1)
+      return mTable[kSize - 1];
+    return mTable[index] + frac * (mTable[index + 1] - mTable[index]);
+  }
+
+private:
+  // IEEE-754 layout of T: cutoff = 2^e * (1 + mantissa), and the top
+  // log2(kPointsPerOctave) mantissa bits pick the entry within octave e.
+  template <typename U, typename = void> struct Bits;
+  template <typename U>
+  struct Bits<U, std::enable_if_t<std::is_same<U, float>::value>> {
+    using Word = uint32_t;
+    static constexpr int kMantissa = 23;
+    static constexpr int kBias = 127;
+  };
+  template <typename U>
+  struct Bits<U, std::enable_if_t<std::is_same<U, double>::value>> {
+    using Word = uint64_t;
+    static constexpr int kMantissa = 52;
+    static constexpr int kBias = 1023;
+  };
+
+  static SEA_INLINE void Position(T cutoff, int &index, T &frac) {
+    using B = Bits<T>;
+    using Word = typename B::Word;
+    constexpr int kIndexBits = 6; // log2(kPointsPerOctave)
+    static_assert((1 << kIndexBits) == kPointsPerOctave,
+                  "kPointsPerOctave must match kIndexBits");
+    constexpr int kFracBits = B::kMantissa - kIndexBits;
+    constexpr Word kFracMask = (Word(1) << kFracBits) - 1;
+    constexpr T kFracScale =
+        static_cast<T>(1.0) / static_cast<T>(Word(1) << kFracBits);
+
+    Word bits;
+    std::memcpy(&bits, &cutoff, sizeof(bits));
+    const int exponent =
+        static_cast<int>(bits >> B::kMantissa) - B::kBias - kMinExponent;
+    index = (exponent << kIndexBits) +
+            static_cast<int>((bits >> kFracBits) &
+                             Word(kPointsPerOctave - 1));
+    frac = static_cast<T>(bits & kFracMask) * kFracScale;
+  }
+
+  T mSampleRate = static_cast<T>(0.0);
+  T mTable[kSize] = {};
+};
+
+} // namespace sea
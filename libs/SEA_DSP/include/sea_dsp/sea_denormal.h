@@ -0,0 +1,107 @@
+#pragma once
+#include "sea_platform.h"
+#include <cstdint>
+
+#if defined(__SSE__) || defined(_M_X64) ||                                     \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define SEA_HAS_FTZ 1
+#define SEA_FTZ_X86 1
+#elif defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__))
+#define SEA_HAS_FTZ 1
+#define SEA_FTZ_AARCH64 1
+#elif defined(__arm__) && defined(__ARM_FP) &&                                 \
+    (defined(__GNUC__) || defined(__clang__))
+#define SEA_HAS_FTZ 1
+#define SEA_FTZ_ARM32 1
+#else
+#define SEA_HAS_FTZ 0
+#endif
+
+// Recursive primitives (TPT integrators, biquads, one-poles, delay feedback)
+// flush their state through UndenormalState(). That is a no-op when the
+// target can flush in hardware (the audio thread is expected to hold a
+// ScopedFlushDenormals); elsewhere it zeroes tiny state in software. Define
+// SEA_DENORMAL_INJECTION to 0/1 to override.
+#ifndef SEA_DENORMAL_INJECTION
+#if SEA_HAS_FTZ
+#define SEA_DENORMAL_INJECTION 0
+#else
+#define SEA_DENORMAL_INJECTION 1
+#endif
+#endif
+
+namespace sea {
+
+/// RAII guard that turns on flush-to-zero (and denormals-are-zero on x86) for
+/// the current thread and restores the previous mode on destruction. Decaying
+/// filter and feedback tails otherwise drift into subnormal numbers, which
+/// cost 10-100x more cycles per operation on most FPUs. Cheap enough to hold
+/// once per host block; nesting is fine.
+class ScopedFlushDenormals {
+public:
+  ScopedFlushDenormals() {
+#if defined(SEA_FTZ_X86)
+    mSaved = _mm_getcsr();
+    _mm_setcsr(mSaved | kFlushBits);
+#elif defined(SEA_FTZ_AARCH64)
+    uint64_t fpcr;
+    __asm__ __volatile__("mrs %0, fpcr" : "=r"(fpcr));
+    mSaved = fpcr;
+    __asm__ __volatile__("msr fpcr, %0" : : "r"(fpcr | kFlushBits));
+#elif defined(SEA_FTZ_ARM32)
+    uint32_t fpscr;
+    __asm__ __volatile__("vmrs %0, fpscr" : "=r"(fpscr));
+    mSaved = fpscr;
+    __asm__ __volatile__("vmsr fpscr, %0" : : "r"(fpscr | kFlushBits));
+#endif
+  }
+
+  ~ScopedFlushDenormals() {
+#if defined(SEA_FTZ_X86)
+    _mm_setcsr(mSaved);
+#elif defined(SEA_FTZ_AARCH64)
+    __asm__ __volatile__("msr fpcr, %0" : : "r"(mSaved));
+#elif defined(SEA_FTZ_ARM32)
+    __asm__ __volatile__("vmsr fpscr, %0" : : "r"(mSaved));
+#endif
+  }
+
+  ScopedFlushDenormals(const ScopedFlushDenormals &) = delete;
+  ScopedFlushDenormals &operator=(const ScopedFlushDenormals &) = delete;
+
+  /// True if this target can flush denormals in hardware.
+  static constexpr bool IsSupported() { return SEA_HAS_FTZ != 0; }
+
+private:
+#if defined(SEA_FTZ_X86)
+  static constexpr unsigned int kFlushBits = 0x8040; // FTZ (15) | DAZ (6)
+  unsigned int mSaved = 0;
+#elif defined(SEA_FTZ_AARCH64)
+  static constexpr uint64_t kFlushBits = uint64_t(1) << 24; // FPCR.FZ
+  uint64_t mSaved = 0;
+#elif defined(SEA_FTZ_ARM32)
+  static constexpr uint32_t kFlushBits = uint32_t(1) << 24; // FPSCR.FZ
+  uint32_t mSaved = 0;
+#endif
+};
+
+/// Zeroes x if its magnitude is below ~-300 dB. Branch-free (compiles to a
+/// compare and mask) and, unlike the add-and-subtract-a-bias trick, survives
+/// -ffast-math.
+template <typename T> SEA_INLINE T FlushDenormal(T x) {
+  constexpr T kThreshold = T(1e-15f);
+  return (x > -kThreshold && x < kThreshold) ? T(0) : x;
+}
+
+/// Software fallback used on recursive filter state; see
+/// SEA_DENORMAL_INJECTION.
+template <typename T> SEA_INLINE T UndenormalState(T x) {
+#if SEA_DENORMAL_INJECTION
+  return FlushDenormal(x);
+#else
+  return x;
+#endif
+}
+
+} // namespace sea
@@ -0,0 +1,291 @@
+#pragma once
+#include "sea_platform.h"
+#include "sea_simd.h"
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace sea {
+
+/// Accuracy tiers for TieredMath. The bounds below hold over the documented
+/// domains for float and double (see Test_FastMath.cpp for the measured
+/// table and ns/element benchmarks):
+///
+///   Tier     bound   tanh   exp2        sin/cos   tan         log2
+///   Exact    libm    std::  std::       std::     std::       std::
+///   Fast     1e-4    [7/6]  cubic       quintic   7th ratio   cubic
+///   Coarse   1e-2    [5/4]  quadratic   cubic     5th ratio   linear
+///
+/// Errors are absolute for tanh, sin, cos and log2 and relative for exp2 and
+/// tan. sea::Math is unchanged and still selects libm or the SEA_FAST_MATH
+/// approximants per build; TieredMath lets a primitive pick a tier itself.
+enum class MathTier { Exact, Fast, Coarse };
+
+namespace detail {
+
+template <typename T> struct FloatBits;
+
+template <> struct FloatBits<float> {
+  using Int = int32_t;
+  static constexpr int kMantissaBits = 23;
+  static constexpr Int kBias = 127;
+  static constexpr Int kMantissaMask = 0x007FFFFF;
+  static constexpr Int kOneBits = 0x3F800000;        // 1.0f
+  static constexpr Int kSqrt2Bits = 0x3FB504F3;      // sqrt(2)
+  static constexpr Int kTwoPowMantissa = 0x4B000000; // 2^23
+  static constexpr float kMaxExp2 = 126.0f;
+};
+
+template <> struct FloatBits<double> {
+  using Int = int64_t;
+  static constexpr int kMantissaBits = 52;
+  static constexpr Int kBias = 1023;
+  static constexpr Int kMantissaMask = 0x000FFFFFFFFFFFFF;
+  static constexpr Int kOneBits = 0x3FF0000000000000;
+  static constexpr Int kSqrt2Bits = 0x3FF6A09E667F3BCD;
+  static constexpr Int kTwoPowMantissa = 0x4330000000000000; // 2^52
+  static constexpr double kMaxExp2 = 1022.0;
+};
+
+template <typename To, typename From> SEA_INLINE To BitCast(From x) {
+  static_assert(sizeof(To) == sizeof(From), "BitCast needs equal sizes");
+  To y;
+  std::memcpy(&y, &x, sizeof(To));
+  return y;
+}
+
+/// Round to nearest by adding and removing 1.5 * 2^mantissa bits, which
+/// pushes the fraction out of the mantissa. Valid for |x| < 2^(bits - 1);
+/// needs IEEE evaluation order (no -ffast-math reassociation).
+template <typename T> SEA_INLINE T RoundShift() {
+  return static_cast<T>(1.5) *
+         BitCast<T>(FloatBits<T>::kTwoPowMantissa);
+}
+
+// The kernels below avoid floating-point compares: with the default
+// -ftrapping-math GCC will not turn them into vector selects, so clamps and
+// folds use fabs/copysign and integer compares on the bit pattern instead.
+
+/// x with its magnitude limited to `limit` (> 0). NaN maps to +-limit.
+template <typename T> SEA_INLINE T ClampMagnitude(T x, T limit) {
+  using Int = typename FloatBits<T>::Int;
+  Int a = BitCast<Int>(std::fabs(x));
+  const Int l = BitCast<Int>(limit);
+  a = a > l ? l : a;
+  return std::copysign(BitCast<T>(a), x);
+}
+
+/// Maps a phase in turns to r in [-1/4, 1/4] with sin(2 pi turns) =
+/// sin(2 pi r).
+template <typename T> SEA_INLINE T ReduceTurns(T turns) {
+  const T shift = RoundShift<T>();
+  const T r = turns - ((turns + shift) - shift); // [-1/2, 1/2]
+  const T quarter = static_cast<T>(0.25);
+  // |r| past a quarter turn reflects to 1/2 - |r|.
+  return std::copysign(quarter - std::fabs(quarter - std::fabs(r)), r);
+}
+
+} // namespace detail
+
+/// Tanh, Exp2, Sin, Cos, Tan and Log2 at a fixed accuracy tier, as scalar
+/// functions and as array versions that map n inputs to n outputs (in and
+/// out may be the same buffer).
+///
+/// The Fast and Coarse kernels are branch-free polynomials and rationals
+/// with IEEE bit tricks in place of floor/frexp/ldexp, so the array loops
+/// below (fixed-width groups of simd::kLanes<T>) compile to SSE2/AVX2/NEON
+/// code. Exact forwards to libm and vectorizes only as far as the compiler's
+/// vector math library allows.
+template <MathTier Tier> struct TieredMath {
+  static constexpr MathTier kTier = Tier;
+
+  /// Any x; saturates to +-1.
+  template <typename T> static SEA_INLINE T Tanh(T x) {
+    if constexpr (Tier == MathTier::Exact) {
+      return std::tanh(x);
+    } else if constexpr (Tier == MathTier::Fast) {
+      // [7/6] Pade, clamped where it reaches 1.
+      x = detail::ClampMagnitude(x, static_cast<T>(4.971786858));
+      const T x2 = x * x;
+      const T num =
+          static_cast<T>(135135.0) +
+          x2 * (static_cast<T>(17325.0) +
+                x2 * (static_cast<T>(378.0) + x2));
+      const T den =
+          static_cast<T>(135135.0) +
+          x2 * (static_cast<T>(62370.0) +
+                x2 * (static_cast<T>(3150.0) + x2 * static_cast<T>(28.0)));
+      return x * num / den;
+    } else {
+      // [5/4] Pade, clamped where it reaches 1.
+      x = detail::ClampMagnitude(x, static_cast<T>(3.646738595));
+      const T x2 = x * x;
+      const T num =
+          static_cast<T>(945.0) + x2 * (static_cast<T>(105.0) + x2);
+      const T den = static_cast<T>(945.0) +
+                    x2 * (static_cast<T>(420.0) + x2 * static_cast<T>(15.0));
+      return x * num / den;
+    }
+  }
+
+  /// 2^x. Fast/Coarse clamp |x| to 126 (float) or 1022 (double), inside the
+  /// normal exponent range.
+  template <typename T> static SEA_INLINE T Exp2(T x) {
+    if constexpr (Tier == MathTier::Exact) {
+      return std::exp2(x);
+    } else {
+      using Bits = detail::FloatBits<T>;
+      using Int = typename Bits::Int;
+      x = detail::ClampMagnitude(x, static_cast<T>(Bits::kMaxExp2));
+      // x = k + f with k = round(x), f in [-1/2, 1/2]; 2^k goes straight
+      // into the exponent field.
+      const T shift = detail::RoundShift<T>();
+      const T shifted = x + shift;
+      const T f = x - (shifted - shift);
+      const Int k = detail::BitCast<Int>(shifted) - detail::BitCast<Int>(shift);
+      const T scale =
+          detail::BitCast<T>((k + Bits::kBias) << Bits::kMantissaBits);
+      T p;
+      if constexpr (Tier == MathTier::Fast) {
+        p = static_cast<T>(0.9999280736) +
+            f * (static_cast<T>(0.6932609858) +
+                 f * (static_cast<T>(0.2426111221) +
+                      f * static_cast<T>(0.05517166722)));
+      } else {
+        p = static_cast<T>(1.000443144) +
+            f * (static_cast<T>(0.7034480049) +
+                 f * static_cast<T>(0.2384289225));
+      }
+      return p * scale;
+    }
+  }
+
+  /// Fast/Coarse keep their bound for |x| up to a few hundred radians in
+  /// float (range reduction is one multiply); oscillator and LFO phases are
+  /// within one cycle.
+  template <typename T> static SEA_INLINE T Sin(T x) {
+    if constexpr (Tier == MathTier::Exact) {
+      return std::sin(x);
+    } else {
+      return SinTurns(x * static_cast<T>(kInvTwoPiD));
+    }
+  }
+
+  template <typename T> static SEA_INLINE T Cos(T x) {
+    if constexpr (Tier == MathTier::Exact) {
+      return std::cos(x);
+    } else {
+      return SinTurns(x * static_cast<T>(kInvTwoPiD) + static_cast<T>(0.25));
+    }
+  }
+
+  /// |x| < pi/2 (filter prewarping). Fast/Coarse divide sine by cosine
+  /// polynomials fitted for relative error, one degree above Sin's, so the
+  /// ratio holds its bound towards the pole.
+  template <typename T> static SEA_INLINE T Tan(T x) {
+    if constexpr (Tier == MathTier::Exact) {
+      return std::tan(x);
+    } else {
+      const T turns = x * static_cast<T>(kInvTwoPiD);
+      return TanKernel(detail::ReduceTurns(turns)) /
+             TanKernel(detail::ReduceTurns(turns + static_cast<T>(0.25)));
+    }
+  }
+
+  /// Positive normal x.
+  template <typename T> static SEA_INLINE T Log2(T x) {
+    if constexpr (Tier == MathTier::Exact) {
+      return std::log2(x);
+    } else {
+      using Bits = detail::FloatBits<T>;
+      using Int = typename Bits::Int;
+      // x = 2^e * m with m in [1, 2), moved to [sqrt(1/2), sqrt(2)); then
+      // log2(m) = P(s) with s = (m - 1) / (m + 1), |s| <= 0.1716.
+      const Int bits = detail::BitCast<Int>(x);
+      Int mBits = (bits & Bits::kMantissaMask) | Bits::kOneBits;
+      const Int upper = mBits > Bits::kSqrt2Bits ? 1 : 0;
+      mBits -= upper << Bits::kMantissaBits; // m / 2
+      // Biased exponent (+1 when m was halved) read back as a float from
+      // the low mantissa bits of 2^mantissaBits.
+      const Int biased = (bits >> Bits::kMantissaBits) + upper;
+      const T e = detail::BitCast<T>(Bits::kTwoPowMantissa | biased) -
+                  detail::BitCast<T>(Bits::kTwoPowMantissa) -
+                  static_cast<T>(Bits::kBias);
+      const T m = detail::BitCast<T>(mBits);
+      const T s = (m - static_cast<T>(1.0)) / (m + static_cast<T>(1.0));
+      if constexpr (Tier == MathTier::Fast) {
+        return e + s * (static_cast<T>(2.885228570) +
+                        s * s * static_cast<T>(0.9835345086));
+      } else {
+        return e + s * static_cast<T>(2.906975451);
+      }
+    }
+  }
+
+  template <typename T> static void Tanh(const T *in, T *out, int n) {
+    Map(in, out, n, [](T x) { return Tanh(x); });
+  }
+  template <typename T> static void Exp2(const T *in, T *out, int n) {
+    Map(in, out, n, [](T x) { return Exp2(x); });
+  }
+  template <typename T> static void Sin(const T *in, T *out, int n) {
+    Map(in, out, n, [](T x) { return Sin(x); });
+  }
+  template <typename T> static void Cos(const T *in, T *out, int n) {
+    Map(in, out, n, [](T x) { return Cos(x); });
+  }
+  template <typename T> static void Tan(const T *in, T *out, int n) {
+    Map(in, out, n, [](T x) { return Tan(x); });
+  }
+  template <typename T> static void Log2(const T *in, T *out, int n) {
+    Map(in, out, n, [](T x) { return Log2(x); });
+  }
+
+private:
+  static constexpr double kInvTwoPiD = 0.15915494309189533577;
+
+  // sin(2 pi t), odd polynomial in the reduced turn.
+  template <typename T> static SEA_INLINE T SinTurns(T t) {
+    const T r = detail::ReduceTurns(t);
+    const T r2 = r * r;
+    if constexpr (Tier == MathTier::Fast) {
+      return r * (static_cast<T>(6.281280076) +
+                  r2 * (static_cast<T>(-41.09524267) +
+                        r2 * static_cast<T>(73.58551452)));
+    } else {
+      return r * (static_cast<T>(6.192264726) +
+                  r2 * static_cast<T>(-35.36370656));
+    }
+  }
+
+  template <typename T> static SEA_INLINE T TanKernel(T r) {
+    const T r2 = r * r;
+    if constexpr (Tier == MathTier::Fast) {
+      return r * (static_cast<T>(6.283179407) +
+                  r2 * (static_cast<T>(-41.33894250) +
+                        r2 * (static_cast<T>(81.39535862) +
+                              r2 * static_cast<T>(-71.47469416))));
+    } else {
+      return r * (static_cast<T>(6.282505600) +
+                  r2 * (static_cast<T>(-41.16644232) +
+                        r2 * static_cast<T>(74.45241849)));
+    }
+  }
+
+  template <typename T, typename Fn>
+  static SEA_INLINE void Map(const T *in, T *out, int n, Fn fn) {
+    constexpr int kLanes = simd::kLanes<T>;
+    int i = 0;
+    for (; i + kLanes <= n; i += kLanes)
+      for (int l = 0; l < kLanes; ++l)
+        out[i + l] = fn(in[i + l]);
+    for (; i < n; ++i)
+      out[i] = fn(in[i]);
+  }
+};
+
+using ExactMath = TieredMath<MathTier::Exact>;
+using FastMath = TieredMath<MathTier::Fast>;
+using CoarseMath = TieredMath<MathTier::Coarse>;
+
+} // namespace sea
@@ -1,13 +1,33 @@
 #pragma once
+#include "sea_coefficient_ramp.h"
 #include "sea_tpt_integrator.h"
 #include <algorithm>
 
 namespace sea {
 
-template <typename T> class LadderFilter {
+/// M supplies Tan (cutoff prewarp) and the per-sample Tanh stages: sea::Math
+/// (libm or SEA_FAST_MATH, per build) by default, or a TieredMath tier such
+/// as FastMath to trade accuracy for speed explicitly.
+template <typename T, typename M = Math> class LadderFilter {
 public:
   enum class Model { Transistor, Diode };
 
+  // Everything ProcessTransistor() reads from SetParams().
+  struct Coefficients {
+    T g;
+    T inv1PlusG;
+    T invFeedbackDenom;
+    T resonance;
+
+    static Coefficients Lerp(const Coefficients &a, const Coefficients &b,
+                             T t) {
+      return {a.g + (b.g - a.g) * t,
+              a.inv1PlusG + (b.inv1PlusG - a.inv1PlusG) * t,
+              a.invFeedbackDenom + (b.invFeedbackDenom - a.invFeedbackDenom) * t,
+              a.resonance + (b.resonance - a.resonance) * t};
+    }
+  };
+
   LadderFilter() = default;
 
   void Init(T sampleRate) {
@@ -28,46 +48,67 @@ public:
 
   void SetParams(Model model, T cutoff, T resonance) {
     mModel = model;
+    mCutoff = ClampCutoff(cutoff);
+    SetCoefficients(ComputeCoefficients(cutoff, resonance));
+  }
 
-    // ClampCutoff logic
-    if (mSampleRate <= static_cast<T>(0.0)) {
-      mCutoff = static_cast<T>(0.0);
-    } else {
-      T nyquist = static_cast<T>(0.5) * mSampleRate;
-      T maxCutoff = nyquist * static_cast<T>(0.95);
-      mCutoff = Math::Clamp(cutoff, static_cast<T>(0.0), maxCutoff);
-    }
-
-    mResonance =
+  // Coefficients SetParams() would produce for cutoff/resonance, without
+  // applying them. Pair with SetCoefficients() to ramp between targets.
+  Coefficients ComputeCoefficients(T cutoff, T resonance) const {
+    Coefficients c;
+    c.resonance =
         Math::Clamp(resonance, static_cast<T>(0.0), static_cast<T>(1.2));
 
     // Prepare G — compute Tan once, share with all integrators via SetG
     if (mSampleRate <= static_cast<T>(0.0)) {
-      g = static_cast<T>(0.0);
-      mInv1PlusG = static_cast<T>(1.0);
-      mInvFeedbackDenom = static_cast<T>(1.0);
-      return;
+      c.g = static_cast<T>(0.0);
+      c.inv1PlusG = static_cast<T>(1.0);
+      c.invFeedbackDenom = static_cast<T>(1.0);
+      return c;
+    }
+    if (mCutoffTable) {
+      c.g = mCutoffTable->Lookup(ClampCutoff(cutoff));
+    } else {
+      T wd = static_cast<T>(kTwoPi) * ClampCutoff(cutoff);
+      T wa = mTwoTimesSampleRate *
+             M::Tan(wd * mInvSampleRate * static_cast<T>(0.5));
+      c.g = wa * mInvSampleRate * static_cast<T>(0.5);
     }
-    T wd = static_cast<T>(kTwoPi) * mCutoff;
-    T wa = mTwoTimesSampleRate *
-           Math::Tan(wd * mInvSampleRate * static_cast<T>(0.5));
-    g = wa * mInvSampleRate * static_cast<T>(0.5);
 
     // Cache reciprocal: eliminates 9 divisions per ProcessTransistor call
-    mInv1PlusG = static_cast<T>(1.0) / (static_cast<T>(1.0) + g);
+    c.inv1PlusG = static_cast<T>(1.0) / (static_cast<T>(1.0) + c.g);
 
     // Cache feedback denominator reciprocal: 1/(1 + k * BETA)
-    T G_lpf = g * mInv1PlusG;
+    T G_lpf = c.g * c.inv1PlusG;
     T BETA = G_lpf * G_lpf * G_lpf * G_lpf;
-    T k = mResonance * static_cast<T>(4.0);
-    mInvFeedbackDenom = static_cast<T>(1.0) / (static_cast<T>(1.0) + k * BETA);
+    T k = c.resonance * static_cast<T>(4.0);
+    c.invFeedbackDenom =
+        static_cast<T>(1.0) / (static_cast<T>(1.0) + k * BETA);
+    return c;
+  }
 
+  // See TPTIntegrator::SetCutoffTable().
+  void SetCutoffTable(const CutoffTable<T> *table) { mCutoffTable = table; }
+
+  void SetCoefficients(const Coefficients &c) {
+    mResonance = c.resonance;
+    g = c.g;
+    mInv1PlusG = c.inv1PlusG;
+    mInvFeedbackDenom = c.invFeedbackDenom;
     // Share g with integrators directly (avoids 4 redundant Tan computations)
     for (int i = 0; i < 4; ++i) {
       integrators[i].SetG(g);
     }
   }
 
+  Coefficients GetCoefficients() const {
+    return {g, mInv1PlusG, mInvFeedbackDenom, mResonance};
+  }
+
+  // Integrator state of stage 0..3 (for LadderFilterLanes to gather/scatter).
+  T GetState(int stage) const { return integrators[stage].GetS(); }
+  void SetState(int stage, T s) { integrators[stage].SetS(s); }
+
   SEA_INLINE T Process(T in) {
     // The original instruction snippet was syntactically incorrect.
     // Assuming the intent was to ensure the filter model is set or used.
@@ -82,7 +123,42 @@ public:
     }
   }
 
+  // Filters n samples while the coefficients ramp from `from` to `to` (see
+  // ProcessRamped()).
+  void ProcessBlock(const T *in, T *out, int n, const Coefficients &from,
+                    const Coefficients &to, int rampPos = 0,
+                    int rampLength = 0) {
+    ProcessRamped(
+        in, out, n, from, to, rampPos, rampLength,
+        [this](const Coefficients &c) { SetCoefficients(c); },
+        [this](T x) { return Process(x); });
+  }
+
+  // Filters n samples with the current model while the cutoff ramps from
+  // cutoffStart to cutoffEnd (Tan evaluated at the ends only). A constant
+  // cutoff is SetParams() followed by per-sample Process().
+  void ProcessBlock(const T *in, T *out, int n, T cutoffStart, T cutoffEnd,
+                    T resonance) {
+    if (cutoffStart == cutoffEnd) {
+      SetParams(mModel, cutoffEnd, resonance);
+      for (int i = 0; i < n; ++i)
+        out[i] = Process(in[i]);
+      return;
+    }
+    ProcessBlock(in, out, n, ComputeCoefficients(cutoffStart, resonance),
+                 ComputeCoefficients(cutoffEnd, resonance));
+    mCutoff = ClampCutoff(cutoffEnd);
+  }
+
 private:
+  T ClampCutoff(T cutoff) const {
+    if (mSampleRate <= static_cast<T>(0.0))
+      return static_cast<T>(0.0);
+    T nyquist = static_cast<T>(0.5) * mSampleRate;
+    T maxCutoff = nyquist * static_cast<T>(0.95);
+    return Math::Clamp(cutoff, static_cast<T>(0.0), maxCutoff);
+  }
+
   SEA_INLINE T ProcessTransistor(T in) {
     // 4 cascaded 1-pole LPFs with global feedback.
     // Uses cached mInv1PlusG and mInvFeedbackDenom (set in SetParams)
@@ -100,13 +176,13 @@ private:
     T k = mResonance * static_cast<T>(4.0);
 
     // Per-sample tanh: nonlinear waveshaping, input varies per sample
-    T u = (Math::Tanh(in) - k * S_total) * mInvFeedbackDenom;
+    T u = (M::Tanh(in) - k * S_total) * mInvFeedbackDenom;
 
     // Compute stages
-    T v = Math::Tanh(u);
+    T v = M::Tanh(u);
     for (int i = 0; i < 4; ++i) {
       T v_out = (g * v + integrators[i].GetS()) * mInv1PlusG;
-      v_out = Math::Tanh(v_out);
+      v_out = M::Tanh(v_out);
       integrators[i].SetS(static_cast<T>(2.0) * v_out - integrators[i].GetS());
       v = v_out;
     }
@@ -123,6 +199,7 @@ private:
   T mInvSampleRate = static_cast<T>(1.0) / static_cast<T>(44100.0);
   T mTwoTimesSampleRate = static_cast<T>(2.0) * static_cast<T>(44100.0);
   Model mModel = Model::Transistor;
+  const CutoffTable<T> *mCutoffTable = nullptr;
   T mCutoff = static_cast<T>(1000.0);
   T mResonance = static_cast<T>(0.0);
   T g = static_cast<T>(0.0);
@@ -0,0 +1,103 @@
+#pragma once
+#include "sea_denormal.h"
+#include "sea_ladder_filter.h"
+#include "sea_simd.h"
+
+namespace sea {
+
+/// Lanes independent transistor ladders run side by side, one per voice,
+/// each with its own coefficients. Process() evaluates all lanes with the
+/// exact arithmetic of LadderFilter<T, M>::Process(), as fixed-width loops over
+/// aligned lane arrays that the compiler maps onto SIMD registers (see
+/// sea_simd.h), so a lane's output is bit-identical to the scalar filter.
+///
+/// The ladder state stays with each voice's LadderFilter: Load() gathers it
+/// (and the coefficients) into a lane at the start of a block and Store()
+/// scatters it back at the end, so a voice can move between batched and
+/// scalar rendering from one block to the next.
+template <typename T, int Lanes, typename M = Math> class LadderFilterLanes {
+public:
+  using Coefficients = typename LadderFilter<T, M>::Coefficients;
+  static constexpr int kLanes = Lanes;
+
+  LadderFilterLanes() { Reset(); }
+
+  /// Zero state, unity coefficients and every lane inactive.
+  void Reset() {
+    for (int l = 0; l < Lanes; ++l) {
+      for (int st = 0; st < 4; ++st)
+        mS[st][l] = static_cast<T>(0.0);
+      mG[l] = static_cast<T>(0.0);
+      mInv1PlusG[l] = static_cast<T>(1.0);
+      mInvFeedbackDenom[l] = static_cast<T>(1.0);
+      mK[l] = static_cast<T>(0.0);
+      mActive[l] = static_cast<T>(0.0);
+    }
+  }
+
+  void Load(int lane, const LadderFilter<T, M> &filter) {
+    for (int st = 0; st < 4; ++st)
+      mS[st][lane] = filter.GetState(st);
+    SetCoefficients(lane, filter.GetCoefficients());
+    SetActive(lane, true);
+  }
+
+  void Store(int lane, LadderFilter<T, M> &filter) const {
+    for (int st = 0; st < 4; ++st)
+      filter.SetState(st, mS[st][lane]);
+  }
+
+  SEA_INLINE void SetCoefficients(int lane, const Coefficients &c) {
+    mG[lane] = c.g;
+    mInv1PlusG[lane] = c.inv1PlusG;
+    mInvFeedbackDenom[lane] = c.invFeedbackDenom;
+    mK[lane] = c.resonance * static_cast<T>(4.0);
+  }
+
+  /// Inactive lanes keep their state and output 0.
+  void SetActive(int lane, bool active) {
+    mActive[lane] = active ? static_cast<T>(1.0) : static_cast<T>(0.0);
+  }
+
+  /// One sample for every lane: out[l] = ladder l (in[l]).
+  SEA_INLINE void Process(const T *SEA_RESTRICT in, T *SEA_RESTRICT out) {
+    for (int l = 0; l < Lanes; ++l) {
+      const T g = mG[l];
+      const T inv = mInv1PlusG[l];
+      const T gLpf = g * inv;
+      const T s0 = mS[0][l] * inv;
+      const T s1 = mS[1][l] * inv;
+      const T s2 = mS[2][l] * inv;
+      const T s3 = mS[3][l] * inv;
+      const T sTotal = gLpf * gLpf * gLpf * s0 + gLpf * gLpf * s1 +
+                       gLpf * s2 + s3;
+      const T u = (M::Tanh(in[l]) - mK[l] * sTotal) * mInvFeedbackDenom[l];
+      T v = M::Tanh(u);
+      const bool active = mActive[l] != static_cast<T>(0.0);
+      for (int st = 0; st < 4; ++st) {
+        T vOut = (g * v + mS[st][l]) * inv;
+        vOut = M::Tanh(vOut);
+        const T next =
+            UndenormalState(static_cast<T>(2.0) * vOut - mS[st][l]);
+        mS[st][l] = active ? next : mS[st][l];
+        v = vOut;
+      }
+      out[l] = active ? v : static_cast<T>(0.0);
+    }
+  }
+
+private:
+  alignas(simd::kAlignment) T mS[4][Lanes];
+  alignas(simd::kAlignment) T mG[Lanes];
+  alignas(simd::kAlignment) T mInv1PlusG[Lanes];
+  alignas(simd::kAlignment) T mInvFeedbackDenom[Lanes];
+  alignas(simd::kAlignment) T mK[Lanes];
+  alignas(simd::kAlignment) T mActive[Lanes];
+};
+
+/// Four lanes: one SSE/NEON register of float.
+template <typename T> using LadderFilter4 = LadderFilterLanes<T, 4>;
+/// Eight lanes: one AVX register of float.
+template <typename T> using LadderFilter8 = LadderFilterLanes<T, 8>;
+
+} // namespace sea
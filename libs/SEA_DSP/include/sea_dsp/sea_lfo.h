@@ -1,5 +1,6 @@
 #pragma once
 #include "sea_math.h"
+#include "sea_phase.h"
 #include "sea_platform.h"
 #include <algorithm>
 
@@ -13,11 +14,17 @@
 
 namespace sea {
 
-class LFO {
+/// Low-frequency oscillator. T is the output/parameter type and PhaseT the
+/// phase accumulator type (see BasicOscillator and PhaseTraits). LFO is the
+/// platform-precision (sea::Real) instantiation.
+template <typename T = Real, typename PhaseT = T>
+class BasicLFO {
 public:
-  LFO() = default;
+  using Phase = PhaseTraits<PhaseT>;
 
-  void Init(Real sampleRate) {
+  BasicLFO() = default;
+
+  void Init(T sampleRate) {
     mSampleRate = sampleRate;
 #ifdef SEA_DSP_LFO_BACKEND_DAISYSP
     mOsc.Init(static_cast<float>(sampleRate));
@@ -25,27 +32,29 @@ public:
     ApplyWaveform();
     mOsc.Reset(0.0f);
 #else
-    mPhase = static_cast<Real>(0.0);
-    mPhaseIncrement = static_cast<Real>(0.0);
+    mPhase = PhaseT(0);
+    mPhaseIncrement = PhaseT(0);
 #endif
   }
 
-  void SetRate(Real hz) {
+  void SetRate(T hz) {
 #ifdef SEA_DSP_LFO_BACKEND_DAISYSP
-    mOsc.SetFreq(static_cast<float>((hz < static_cast<Real>(0.0))
-                                        ? static_cast<Real>(0.0)
+    mOsc.SetFreq(static_cast<float>((hz < static_cast<T>(0.0))
+                                        ? static_cast<T>(0.0)
                                         : hz));
 #else
-    if (mSampleRate > static_cast<Real>(0.0)) {
-      mPhaseIncrement =
-          ((hz < static_cast<Real>(0.0)) ? static_cast<Real>(0.0) : hz) /
-          mSampleRate;
+    if (mSampleRate > static_cast<T>(0.0)) {
+      using Scalar = typename Phase::Scalar;
+      mPhaseIncrement = Phase::FromCycles(
+          static_cast<Scalar>((hz < static_cast<T>(0.0)) ? static_cast<T>(0.0)
+                                                         : hz) /
+          static_cast<Scalar>(mSampleRate));
     }
 #endif
   }
 
-  void SetDepth(Real depth) {
-    mDepth = Math::Clamp(depth, static_cast<Real>(0.0), static_cast<Real>(1.0));
+  void SetDepth(T depth) {
+    mDepth = Math::Clamp(depth, static_cast<T>(0.0), static_cast<T>(1.0));
   }
 
   void SetWaveform(int type) {
@@ -55,42 +64,65 @@ public:
 #endif
   }
 
-  SEA_INLINE Real Process() {
+  int GetWaveform() const { return mWaveform; }
+  T GetDepth() const { return mDepth; }
+
+  /// Phase of the next Process() sample in cycles, [0, 1). Always 0 with
+  /// the DaisySP backend (no phase access).
+  T GetPhase() const {
+#ifdef SEA_DSP_LFO_BACKEND_DAISYSP
+    return static_cast<T>(0.0);
+#else
+    return Phase::template ToCycles<T>(mPhase);
+#endif
+  }
+
+  SEA_INLINE T Process() {
 #ifdef SEA_DSP_LFO_BACKEND_DAISYSP
-    return static_cast<Real>(mOsc.Process()) * mDepth;
+    return static_cast<T>(mOsc.Process()) * mDepth;
 #else
-    Real out = static_cast<Real>(0.0);
+    T out = static_cast<T>(0.0);
+    const T phase = Phase::template ToCycles<T>(mPhase);
 
     switch (mWaveform) {
     case 0: // Sine
-      out = Math::Sin(kTwoPi * mPhase);
+      out = static_cast<T>(
+          Math::Sin(kTwoPi * Phase::template ToCycles<Real>(mPhase)));
       break;
     case 1: // Triangle
-      out = (static_cast<Real>(4.0) *
-             Math::Abs(mPhase - static_cast<Real>(0.5))) -
-            static_cast<Real>(1.0);
+      out = (static_cast<T>(4.0) *
+             std::abs(phase - static_cast<T>(0.5))) -
+            static_cast<T>(1.0);
       break;
     case 2: // Square
-      out = (mPhase < static_cast<Real>(0.5)) ? static_cast<Real>(1.0)
-                                              : static_cast<Real>(-1.0);
+      out = (phase < static_cast<T>(0.5)) ? static_cast<T>(1.0)
+                                          : static_cast<T>(-1.0);
       break;
     case 3: // Saw
-      out = (static_cast<Real>(2.0) * mPhase) - static_cast<Real>(1.0);
+      out = (static_cast<T>(2.0) * phase) - static_cast<T>(1.0);
       break;
     default:
-      out = static_cast<Real>(0.0);
+      out = static_cast<T>(0.0);
       break;
     }
 
-    mPhase += mPhaseIncrement;
-    if (mPhase >= static_cast<Real>(1.0)) {
-      mPhase -= static_cast<Real>(1.0);
-    }
+    mPhase = Phase::Advance(mPhase, mPhaseIncrement);
 
     return out * mDepth;
 #endif
   }
 
+  /// Skips numSamples Process() calls in constant time (seeking, pre-roll).
+  /// The DaisySP backend has no phase access and steps sample by sample.
+  void Advance(uint64_t numSamples) {
+#ifdef SEA_DSP_LFO_BACKEND_DAISYSP
+    for (uint64_t i = 0; i < numSamples; ++i)
+      mOsc.Process();
+#else
+    mPhase = Phase::AdvanceBy(mPhase, mPhaseIncrement, numSamples);
+#endif
+  }
+
 private:
 #ifdef SEA_DSP_LFO_BACKEND_DAISYSP
   void ApplyWaveform() {
@@ -114,16 +146,18 @@ private:
   }
 #endif
 
-  Real mSampleRate = static_cast<Real>(44100.0);
+  T mSampleRate = static_cast<T>(44100.0);
 #ifndef SEA_DSP_LFO_BACKEND_DAISYSP
-  Real mPhase = static_cast<Real>(0.0);
-  Real mPhaseIncrement = static_cast<Real>(0.0);
+  PhaseT mPhase = PhaseT(0);
+  PhaseT mPhaseIncrement = PhaseT(0);
 #endif
-  Real mDepth = static_cast<Real>(0.0);
+  T mDepth = static_cast<T>(0.0);
   int mWaveform = 0;
 #ifdef SEA_DSP_LFO_BACKEND_DAISYSP
   daisysp::Oscillator mOsc;
 #endif
 };
 
+using LFO = BasicLFO<Real>;
+
 } // namespace sea
@@ -0,0 +1,56 @@
+#pragma once
+
+namespace sea {
+
+/// Linear parameter smoother. SetTarget() computes the per-step increment
+/// once (typically once per host block); Next() then costs one add per step,
+/// so the DSP reads a linearly ramped value without recomputing anything.
+/// A step is whatever the caller ticks it at: one sample for gains and mixes,
+/// one control period for parameters that feed coefficient calculations.
+template <typename T>
+class LinearRamp {
+public:
+  /// Jumps to value with no ramp.
+  void Reset(T value) {
+    current_ = value;
+    target_ = value;
+    step_ = T(0);
+    remaining_ = 0;
+  }
+
+  /// Ramps from the current value to target over numSteps steps. numSteps
+  /// <= 0 (or an unchanged target) snaps immediately.
+  void SetTarget(T target, int numSteps) {
+    if (numSteps <= 0 || target == current_) {
+      Reset(target);
+      return;
+    }
+    target_ = target;
+    step_ = (target - current_) / static_cast<T>(numSteps);
+    remaining_ = numSteps;
+  }
+
+  /// Advances one step and returns the new value. The last step lands
+  /// exactly on the target.
+  T Next() {
+    if (remaining_ > 0) {
+      current_ += step_;
+      if (--remaining_ == 0)
+        current_ = target_;
+    }
+    return current_;
+  }
+
+  T Current() const { return current_; }
+  T Target() const { return target_; }
+  bool IsRamping() const { return remaining_ > 0; }
+  int GetRemainingSteps() const { return remaining_; }
+
+private:
+  T current_ = T(0);
+  T target_ = T(0);
+  T step_ = T(0);
+  int remaining_ = 0;
+};
+
+} // namespace sea
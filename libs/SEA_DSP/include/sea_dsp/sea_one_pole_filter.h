@@ -1,5 +1,6 @@
 #pragma once
 
+#include "sea_denormal.h"
 #include <cmath>
 #include <algorithm>
 
@@ -36,7 +37,7 @@ public:
   T Process(T input) {
     // One-pole low-pass filter (leaky integrator)
     // y[n] = y[n-1] + b1 * (x[n] - y[n-1])
-    z1_ = z1_ + b1_ * (input - z1_);
+    z1_ = UndenormalState(z1_ + b1_ * (input - z1_));
     return z1_;
   }
 
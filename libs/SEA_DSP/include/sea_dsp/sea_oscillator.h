@@ -1,5 +1,6 @@
 #pragma once
 #include "sea_math.h"
+#include "sea_phase.h"
 #include "sea_platform.h"
 #include <algorithm>
 
@@ -13,16 +14,70 @@
 
 namespace sea {
 
-class Oscillator {
+enum class OscillatorWaveform { Saw, Square, Triangle, Sine };
+
+/// Naive: trivial waveforms, aliasing at high notes (the default).
+/// PolyBLEP: 2-point polynomial corrections around each discontinuity
+/// (PolyBLEP for saw/square edges, PolyBLAMP for triangle corners).
+enum class OscillatorAntialias { Naive, PolyBLEP };
+
+namespace detail {
+
+// Residual of a band-limited step of height +2 (the jump of the naive saw
+// and square), t = phase in [0, 1), dt = phase increment. Non-zero only in
+// the sample either side of the wrap.
+template <typename T> SEA_INLINE T PolyBlep(T t, T dt) {
+  if (t < dt) {
+    t /= dt;
+    return t + t - t * t - static_cast<T>(1.0);
+  }
+  if (t > static_cast<T>(1.0) - dt) {
+    t = (t - static_cast<T>(1.0)) / dt;
+    return t * t + t + t + static_cast<T>(1.0);
+  }
+  return static_cast<T>(0.0);
+}
+
+// Residual of a band-limited unit-slope corner (the integral of PolyBlep's
+// unit-step form), in samples. Scale by the change in slope per sample.
+template <typename T> SEA_INLINE T PolyBlamp(T t, T dt) {
+  constexpr T kSixth = static_cast<T>(1.0) / static_cast<T>(6.0);
+  if (t < dt) {
+    const T x = static_cast<T>(1.0) - t / dt;
+    return x * x * x * kSixth;
+  }
+  if (t > static_cast<T>(1.0) - dt) {
+    const T x = (t - static_cast<T>(1.0)) / dt + static_cast<T>(1.0);
+    return x * x * x * kSixth;
+  }
+  return static_cast<T>(0.0);
+}
+
+template <typename T> SEA_INLINE T WrapPhase(T t) {
+  return (t >= static_cast<T>(1.0)) ? t - static_cast<T>(1.0) : t;
+}
+
+} // namespace detail
+
+/// Oscillator with naive or PolyBLEP band-limited waveforms (see
+/// SetAntialias). T is the output/parameter type and
+/// PhaseT the phase accumulator type, which can be wider than T to keep
+/// long-running phase error down on a float audio path, or uint32_t for a
+/// fixed-point accumulator that wraps by overflow (see PhaseTraits).
+/// Oscillator is the platform-precision (sea::Real) instantiation.
+template <typename T = Real, typename PhaseT = T>
+class BasicOscillator {
 public:
-  enum class WaveformType { Saw, Square, Triangle, Sine };
+  using WaveformType = OscillatorWaveform;
+  using Antialias = OscillatorAntialias;
+  using Phase = PhaseTraits<PhaseT>;
 
-  Oscillator() = default;
+  BasicOscillator() = default;
 
   /**
    * @brief Initialize with sample rate.
    */
-  void Init(Real sampleRate) {
+  void Init(T sampleRate) {
     mSampleRate = sampleRate;
 #ifdef SEA_DSP_OSC_BACKEND_DAISYSP
     mOsc.Init(static_cast<float>(sampleRate));
@@ -31,9 +86,10 @@ public:
     mOsc.SetPw(static_cast<float>(mPulseWidth));
     mOsc.Reset(0.0f);
 #else
-    mInvSampleRate = static_cast<Real>(1.0) / sampleRate;
-    mPhase = static_cast<Real>(0.0);
-    mPhaseIncrement = static_cast<Real>(0.0);
+    mInvSampleRate = static_cast<typename Phase::Scalar>(1.0) /
+                     static_cast<typename Phase::Scalar>(sampleRate);
+    mPhase = PhaseT(0);
+    mPhaseIncrement = PhaseT(0);
 #endif
   }
 
@@ -44,18 +100,18 @@ public:
 #ifdef SEA_DSP_OSC_BACKEND_DAISYSP
     mOsc.Reset(0.0f);
 #else
-    mPhase = static_cast<Real>(0.0);
+    mPhase = PhaseT(0);
 #endif
   }
 
   /**
    * @brief Set frequency in Hz.
    */
-  void SetFrequency(Real freq) {
+  void SetFrequency(T freq) {
 #ifdef SEA_DSP_OSC_BACKEND_DAISYSP
     mOsc.SetFreq(static_cast<float>(freq));
 #else
-    mPhaseIncrement = freq * mInvSampleRate;
+    mPhaseIncrement = ToIncrement(freq);
 #endif
   }
 
@@ -70,13 +126,39 @@ public:
   }
 
   /**
-   * @brief Get current phase increment (diagnostic).
+   * @brief Select naive or PolyBLEP band-limited waveforms.
+   * PolyBLEP costs a few extra operations per sample and keeps aliasing of
+   * saw/square/pulse/triangle low enough to run at 44.1/48 kHz without
+   * oversampling. Sine is unaffected.
    */
-  Real GetPhaseIncrement() const {
+  void SetAntialias(Antialias mode) {
+    mAntialias = mode;
 #ifdef SEA_DSP_OSC_BACKEND_DAISYSP
-    return static_cast<Real>(0); // Not available with DaisySP backend
+    ApplyWaveform();
+#endif
+  }
+
+  Antialias GetAntialias() const { return mAntialias; }
+
+  /**
+   * @brief Get current phase increment in cycles per sample (diagnostic).
+   */
+  T GetPhaseIncrement() const {
+#ifdef SEA_DSP_OSC_BACKEND_DAISYSP
+    return static_cast<T>(0); // Not available with DaisySP backend
 #else
-    return mPhaseIncrement;
+    return Phase::template ToCycles<T>(mPhaseIncrement);
+#endif
+  }
+
+  /**
+   * @brief Get current phase in cycles, [0, 1) (diagnostic).
+   */
+  T GetPhase() const {
+#ifdef SEA_DSP_OSC_BACKEND_DAISYSP
+    return static_cast<T>(0); // Not available with DaisySP backend
+#else
+    return Phase::template ToCycles<T>(mPhase);
 #endif
   }
 
@@ -84,9 +166,9 @@ public:
    * @brief Set pulse width for square wave.
    * Range: (0.0, 1.0)
    */
-  void SetPulseWidth(Real pw) {
+  void SetPulseWidth(T pw) {
     mPulseWidth =
-        Math::Clamp(pw, static_cast<Real>(0.01), static_cast<Real>(0.99));
+        Math::Clamp(pw, static_cast<T>(0.01), static_cast<T>(0.99));
 #ifdef SEA_DSP_OSC_BACKEND_DAISYSP
     mOsc.SetPw(static_cast<float>(mPulseWidth));
 #endif
@@ -96,56 +178,260 @@ public:
    * @brief Render one sample.
    * Range: [-1.0, 1.0]
    */
-  SEA_INLINE Real Process() {
+  SEA_INLINE T Process() {
 #ifdef SEA_DSP_OSC_BACKEND_DAISYSP
-    Real out = static_cast<Real>(mOsc.Process());
+    T out = static_cast<T>(mOsc.Process());
     if (mWaveform == WaveformType::Saw) {
       out = -out;
     }
     return out;
 #else
-    Real out = static_cast<Real>(0.0);
+    T out = static_cast<T>(0.0);
+    const T phase = Phase::template ToCycles<T>(mPhase);
+
+    if (mAntialias == Antialias::PolyBLEP && mWaveform != WaveformType::Sine) {
+      out = ProcessPolyBlep(phase, Phase::template ToCycles<T>(mPhaseIncrement));
+      Advance();
+      return out;
+    }
 
     switch (mWaveform) {
     case WaveformType::Saw:
-      out = (static_cast<Real>(2.0) * mPhase) - static_cast<Real>(1.0);
+      out = (static_cast<T>(2.0) * phase) - static_cast<T>(1.0);
       break;
     case WaveformType::Square:
-      out = (mPhase < mPulseWidth) ? static_cast<Real>(1.0)
-                                   : static_cast<Real>(-1.0);
+      out = (phase < mPulseWidth) ? static_cast<T>(1.0)
+                                  : static_cast<T>(-1.0);
       break;
     case WaveformType::Triangle:
-      out = (static_cast<Real>(4.0) *
-             Math::Abs(mPhase - static_cast<Real>(0.5))) -
-            static_cast<Real>(1.0);
+      out = (static_cast<T>(4.0) *
+             std::abs(phase - static_cast<T>(0.5))) -
+            static_cast<T>(1.0);
       break;
     case WaveformType::Sine:
       // Wavetable on embedded (SEA_FAST_MATH), std::sin on desktop
-      out = Math::Sin(kTwoPi * mPhase);
+      out = static_cast<T>(
+          Math::Sin(kTwoPi * Phase::template ToCycles<Real>(mPhase)));
       break;
     }
 
-    mPhase += mPhaseIncrement;
-    if (mPhase >= static_cast<Real>(1.0)) {
-      mPhase -= static_cast<Real>(1.0);
-    }
-
+    Advance();
     return out;
 #endif
   }
 
+  /**
+   * @brief Skip numSamples Process() calls in constant time (seeking,
+   * pre-roll). The DaisySP backend has no phase access and steps sample by
+   * sample.
+   */
+  void Advance(uint64_t numSamples) {
+#ifdef SEA_DSP_OSC_BACKEND_DAISYSP
+    for (uint64_t i = 0; i < numSamples; ++i)
+      mOsc.Process();
+#else
+    mPhase = Phase::AdvanceBy(mPhase, mPhaseIncrement, numSamples);
+#endif
+  }
+
+  /**
+   * @brief Render n samples.
+   * freq (Hz) and pw, if non-null, give a per-sample frequency / pulse
+   * width (as if SetFrequency/SetPulseWidth ran before each sample);
+   * nullptr holds the current value. Produces exactly the samples of n
+   * Process() calls, but resolves waveform and antialias mode once per
+   * block: the phase accumulation runs as its own tight pass and the
+   * waveform shaping as a per-waveform kernel. The naive saw, square and
+   * triangle kernels are branch-free and vectorise; the PolyBLEP/PolyBLAMP
+   * corrections branch on the edge window and the sine calls Math::Sin, so
+   * those kernels stay scalar loops.
+   */
+  void ProcessBlock(T *out, int n, const T *freq = nullptr,
+                    const T *pw = nullptr) {
+#ifdef SEA_DSP_OSC_BACKEND_DAISYSP
+    for (int i = 0; i < n; ++i) {
+      if (freq)
+        SetFrequency(freq[i]);
+      if (pw)
+        SetPulseWidth(pw[i]);
+      out[i] = Process();
+    }
+#else
+    PhaseT phase[kBlockChunk];
+    PhaseT inc[kBlockChunk];
+    T width[kBlockChunk];
+    while (n > 0) {
+      const int len = (n < kBlockChunk) ? n : kBlockChunk;
+      if (freq) {
+        for (int i = 0; i < len; ++i)
+          inc[i] = ToIncrement(freq[i]);
+        mPhaseIncrement = inc[len - 1];
+      } else {
+        for (int i = 0; i < len; ++i)
+          inc[i] = mPhaseIncrement;
+      }
+      // Running sum, the same arithmetic as Advance(), so output does not
+      // depend on how calls are chunked.
+      for (int i = 0; i < len; ++i) {
+        phase[i] = mPhase;
+        mPhase = Phase::Advance(mPhase, inc[i]);
+      }
+      if (pw) {
+        for (int i = 0; i < len; ++i)
+          width[i] = Math::Clamp(pw[i], static_cast<T>(0.01),
+                                 static_cast<T>(0.99));
+        mPulseWidth = width[len - 1];
+      } else {
+        for (int i = 0; i < len; ++i)
+          width[i] = mPulseWidth;
+      }
+      RenderKernel(out, phase, inc, width, len);
+      out += len;
+      n -= len;
+      if (freq)
+        freq += len;
+      if (pw)
+        pw += len;
+    }
+#endif
+  }
+
+#ifndef SEA_DSP_OSC_BACKEND_DAISYSP
+  /// One sample of waveform W at the given phase, increment and pulse
+  /// width. Mirrors the expressions in Process() / ProcessPolyBlep(), so
+  /// the block kernels (and OscillatorLanes) agree with Process().
+  template <WaveformType W, bool kBlep>
+  static SEA_INLINE T Shape(PhaseT phase, PhaseT inc, T width) {
+    constexpr T kOne = static_cast<T>(1.0);
+    constexpr T kHalf = static_cast<T>(0.5);
+    const T p = Phase::template ToCycles<T>(phase);
+    T s;
+    if constexpr (W == WaveformType::Saw) {
+      s = (static_cast<T>(2.0) * p) - kOne;
+      if constexpr (kBlep)
+        s -= detail::PolyBlep(p, Phase::template ToCycles<T>(inc));
+    } else if constexpr (W == WaveformType::Square) {
+      s = (p < width) ? kOne : -kOne;
+      if constexpr (kBlep) {
+        const T dt = Phase::template ToCycles<T>(inc);
+        s += detail::PolyBlep(p, dt);
+        s -= detail::PolyBlep(detail::WrapPhase(p + kOne - width), dt);
+      }
+    } else if constexpr (W == WaveformType::Triangle) {
+      s = (static_cast<T>(4.0) * std::abs(p - kHalf)) - kOne;
+      if constexpr (kBlep) {
+        const T dt = Phase::template ToCycles<T>(inc);
+        const T corner = static_cast<T>(8.0) * dt;
+        s -= corner * detail::PolyBlamp(p, dt);
+        s += corner * detail::PolyBlamp(detail::WrapPhase(p + kHalf), dt);
+      }
+    } else {
+      s = static_cast<T>(
+          Math::Sin(kTwoPi * Phase::template ToCycles<Real>(phase)));
+    }
+    return s;
+  }
+
+  // Raw accumulator state (for OscillatorLanes to gather/scatter).
+  PhaseT GetRawPhase() const { return mPhase; }
+  void SetRawPhase(PhaseT phase) { mPhase = phase; }
+  PhaseT GetRawIncrement() const { return mPhaseIncrement; }
+#endif
+  WaveformType GetWaveform() const { return mWaveform; }
+  T GetPulseWidth() const { return mPulseWidth; }
+
 private:
+#ifndef SEA_DSP_OSC_BACKEND_DAISYSP
+  static constexpr int kBlockChunk = 64;
+
+  void RenderKernel(T *out, const PhaseT *phase, const PhaseT *inc,
+                    const T *width, int n) const {
+    if (mAntialias == Antialias::PolyBLEP)
+      RenderKernel<true>(out, phase, inc, width, n);
+    else
+      RenderKernel<false>(out, phase, inc, width, n);
+  }
+
+  template <bool kBlep>
+  void RenderKernel(T *out, const PhaseT *phase, const PhaseT *inc,
+                    const T *width, int n) const {
+    switch (mWaveform) {
+    case WaveformType::Saw:
+      Kernel<WaveformType::Saw, kBlep>(out, phase, inc, width, n);
+      break;
+    case WaveformType::Square:
+      Kernel<WaveformType::Square, kBlep>(out, phase, inc, width, n);
+      break;
+    case WaveformType::Triangle:
+      Kernel<WaveformType::Triangle, kBlep>(out, phase, inc, width, n);
+      break;
+    case WaveformType::Sine:
+      Kernel<WaveformType::Sine, false>(out, phase, inc, width, n);
+      break;
+    }
+  }
+
+  // One waveform, one antialias mode, no per-sample dispatch.
+  template <WaveformType W, bool kBlep>
+  static void Kernel(T *out, const PhaseT *phase, const PhaseT *inc,
+                     const T *width, int n) {
+    for (int i = 0; i < n; ++i)
+      out[i] = Shape<W, kBlep>(phase[i], inc[i], width[i]);
+  }
+#endif
+
+#ifndef SEA_DSP_OSC_BACKEND_DAISYSP
+  SEA_INLINE void Advance() { mPhase = Phase::Advance(mPhase, mPhaseIncrement); }
+
+  SEA_INLINE PhaseT ToIncrement(T freq) const {
+    return Phase::FromCycles(static_cast<typename Phase::Scalar>(freq) *
+                             mInvSampleRate);
+  }
+
+  // Naive waveform plus the polynomial residual of every discontinuity
+  // (saw/square) or slope corner (triangle) within one sample of phase.
+  SEA_INLINE T ProcessPolyBlep(T phase, T dt) {
+    constexpr T kOne = static_cast<T>(1.0);
+    switch (mWaveform) {
+    case WaveformType::Square: {
+      T out = (phase < mPulseWidth) ? kOne : -kOne;
+      out += detail::PolyBlep(phase, dt);
+      out -= detail::PolyBlep(detail::WrapPhase(phase + kOne - mPulseWidth), dt);
+      return out;
+    }
+    case WaveformType::Triangle: {
+      // Slope is +/-4 per cycle, so each corner changes it by 8 * dt per
+      // sample: down at phase 0 (peak), up at phase 0.5 (trough).
+      const T half = static_cast<T>(0.5);
+      T out = static_cast<T>(4.0) * std::abs(phase - half) - kOne;
+      const T corner = static_cast<T>(8.0) * dt;
+      out -= corner * detail::PolyBlamp(phase, dt);
+      out += corner * detail::PolyBlamp(detail::WrapPhase(phase + half), dt);
+      return out;
+    }
+    case WaveformType::Saw:
+    default:
+      return (static_cast<T>(2.0) * phase) - kOne -
+             detail::PolyBlep(phase, dt);
+    }
+  }
+#endif
+
 #ifdef SEA_DSP_OSC_BACKEND_DAISYSP
   void ApplyWaveform() {
+    const bool blep = (mAntialias == Antialias::PolyBLEP);
     switch (mWaveform) {
     case WaveformType::Saw:
-      mOsc.SetWaveform(daisysp::Oscillator::WAVE_SAW);
+      mOsc.SetWaveform(blep ? daisysp::Oscillator::WAVE_POLYBLEP_SAW
+                            : daisysp::Oscillator::WAVE_SAW);
       break;
     case WaveformType::Square:
-      mOsc.SetWaveform(daisysp::Oscillator::WAVE_SQUARE);
+      mOsc.SetWaveform(blep ? daisysp::Oscillator::WAVE_POLYBLEP_SQUARE
+                            : daisysp::Oscillator::WAVE_SQUARE);
       break;
     case WaveformType::Triangle:
-      mOsc.SetWaveform(daisysp::Oscillator::WAVE_TRI);
+      mOsc.SetWaveform(blep ? daisysp::Oscillator::WAVE_POLYBLEP_TRI
+                            : daisysp::Oscillator::WAVE_TRI);
       break;
     case WaveformType::Sine:
     default:
@@ -155,17 +441,22 @@ private:
   }
 #endif
 
-  Real mSampleRate = static_cast<Real>(44100.0);
+  T mSampleRate = static_cast<T>(44100.0);
 #ifndef SEA_DSP_OSC_BACKEND_DAISYSP
-  Real mInvSampleRate = static_cast<Real>(1.0) / static_cast<Real>(44100.0);
-  Real mPhase = static_cast<Real>(0.0);
-  Real mPhaseIncrement = static_cast<Real>(0.0);
+  typename Phase::Scalar mInvSampleRate =
+      static_cast<typename Phase::Scalar>(1.0) /
+      static_cast<typename Phase::Scalar>(44100.0);
+  PhaseT mPhase = PhaseT(0);
+  PhaseT mPhaseIncrement = PhaseT(0);
 #endif
-  Real mPulseWidth = static_cast<Real>(0.5);
+  T mPulseWidth = static_cast<T>(0.5);
   WaveformType mWaveform = WaveformType::Saw;
+  Antialias mAntialias = Antialias::Naive;
 #ifdef SEA_DSP_OSC_BACKEND_DAISYSP
   daisysp::Oscillator mOsc;
 #endif
 };
 
+using Oscillator = BasicOscillator<Real>;
+
 } // namespace sea
@@ -0,0 +1,102 @@
+#pragma once
+#include "sea_oscillator.h"
+#include "sea_simd.h"
+
+#ifdef SEA_DSP_OSC_BACKEND_DAISYSP
+#error "OscillatorLanes needs the sea_core oscillator backend"
+#endif
+
+namespace sea {
+
+/// Lanes oscillators run side by side, one per voice, sharing a waveform
+/// and antialias mode but each with its own phase, increment and pulse
+/// width. ProcessBlock() evaluates every lane with the same Shape()
+/// expressions as BasicOscillator, as fixed-width loops over aligned lane
+/// arrays (see sea_simd.h), so a lane's output is bit-identical to the
+/// scalar oscillator's ProcessBlock() at a fixed frequency.
+///
+/// As with LadderFilterLanes the phase stays with each oscillator: Load()
+/// gathers it at the start of a block and Store() scatters it back.
+template <typename T, typename PhaseT, int Lanes> class OscillatorLanes {
+public:
+  using Oscillator = BasicOscillator<T, PhaseT>;
+  using WaveformType = typename Oscillator::WaveformType;
+  using Antialias = typename Oscillator::Antialias;
+  using Phase = typename Oscillator::Phase;
+  static constexpr int kLanes = Lanes;
+
+  OscillatorLanes() { Reset(); }
+
+  /// Zero phase and increment, every lane inactive.
+  void Reset() {
+    for (int l = 0; l < Lanes; ++l) {
+      mPhase[l] = PhaseT(0);
+      mInc[l] = PhaseT(0);
+      mStep[l] = PhaseT(0);
+      mWidth[l] = static_cast<T>(0.5);
+    }
+  }
+
+  /// Waveform and antialias mode are taken from the oscillator loaded last;
+  /// every loaded lane must share them.
+  void Load(int lane, const Oscillator &osc) {
+    mWaveform = osc.GetWaveform();
+    mAntialias = osc.GetAntialias();
+    mPhase[lane] = osc.GetRawPhase();
+    mInc[lane] = osc.GetRawIncrement();
+    mWidth[lane] = osc.GetPulseWidth();
+    SetActive(lane, true);
+  }
+
+  void Store(int lane, Oscillator &osc) const {
+    osc.SetRawPhase(mPhase[lane]);
+  }
+
+  /// Inactive lanes hold their phase.
+  void SetActive(int lane, bool active) {
+    mStep[lane] = active ? mInc[lane] : PhaseT(0);
+  }
+
+  /// n samples of every lane, lane-interleaved: out[i * Lanes + l].
+  void ProcessBlock(T *SEA_RESTRICT out, int n) {
+    const bool blep = mAntialias == Antialias::PolyBLEP;
+    switch (mWaveform) {
+    case WaveformType::Saw:
+      blep ? Kernel<WaveformType::Saw, true>(out, n)
+           : Kernel<WaveformType::Saw, false>(out, n);
+      break;
+    case WaveformType::Square:
+      blep ? Kernel<WaveformType::Square, true>(out, n)
+           : Kernel<WaveformType::Square, false>(out, n);
+      break;
+    case WaveformType::Triangle:
+      blep ? Kernel<WaveformType::Triangle, true>(out, n)
+           : Kernel<WaveformType::Triangle, false>(out, n);
+      break;
+    case WaveformType::Sine:
+      Kernel<WaveformType::Sine, false>(out, n);
+      break;
+    }
+  }
+
+private:
+  template <WaveformType W, bool kBlep>
+  void Kernel(T *SEA_RESTRICT out, int n) {
+    for (int i = 0; i < n; ++i, out += Lanes) {
+      for (int l = 0; l < Lanes; ++l) {
+        out[l] = Oscillator::template Shape<W, kBlep>(mPhase[l], mInc[l],
+                                                       mWidth[l]);
+        mPhase[l] = Phase::Advance(mPhase[l], mStep[l]);
+      }
+    }
+  }
+
+  alignas(simd::kAlignment) PhaseT mPhase[Lanes];
+  alignas(simd::kAlignment) PhaseT mInc[Lanes];
+  alignas(simd::kAlignment) PhaseT mStep[Lanes];
+  alignas(simd::kAlignment) T mWidth[Lanes];
+  WaveformType mWaveform = WaveformType::Saw;
+  Antialias mAntialias = Antialias::Naive;
+};
+
+} // namespace sea
@@ -0,0 +1,95 @@
+#pragma once
+#include "sea_platform.h"
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace sea {
+
+/// Phase accumulator arithmetic for the PhaseT parameter of BasicOscillator
+/// and BasicLFO. Phase and increment are stored in PhaseT; everything else
+/// works in cycles (phase in [0, 1), increment in cycles per sample).
+///
+/// Floating-point PhaseT (the default) wraps with a compare-and-subtract.
+template <typename PhaseT, typename = void> struct PhaseTraits {
+  static_assert(std::is_floating_point<PhaseT>::value,
+                "PhaseT must be floating point or uint32_t");
+
+  /// Type the frequency -> increment conversion is computed in.
+  using Scalar = PhaseT;
+
+  static SEA_INLINE PhaseT FromCycles(Scalar cycles) { return cycles; }
+
+  template <typename T> static SEA_INLINE T ToCycles(PhaseT phase) {
+    return static_cast<T>(phase);
+  }
+
+  /// Written as a select so block loops stay branch-free.
+  static SEA_INLINE PhaseT Advance(PhaseT phase, PhaseT increment) {
+    phase += increment;
+    return phase - ((phase >= static_cast<PhaseT>(1.0))
+                        ? static_cast<PhaseT>(1.0)
+                        : static_cast<PhaseT>(0.0));
+  }
+
+  /// Phase after n Advance() calls, in O(1): the fractional part of
+  /// phase + n * increment, taken in double so a long seek keeps its
+  /// fraction. Matches the per-sample accumulation to its rounding.
+  static SEA_INLINE PhaseT AdvanceBy(PhaseT phase, PhaseT increment,
+                                     uint64_t n) {
+    const double cycles = static_cast<double>(phase) +
+                          static_cast<double>(increment) *
+                              static_cast<double>(n);
+    const PhaseT wrapped = static_cast<PhaseT>(cycles - std::floor(cycles));
+    // Rounding to a narrower PhaseT can land on 1.
+    return wrapped >= static_cast<PhaseT>(1.0) ? static_cast<PhaseT>(0.0)
+                                               : wrapped;
+  }
+};
+
+/// uint32_t PhaseT: 0.32 fixed point, one cycle = 2^32. Wraps by integer
+/// overflow (no compare), so a note's phase after n samples is exactly
+/// n * increment mod 2^32 however long it runs; pitch error is only the
+/// rounding of the increment (< 2^-33 cycles per sample with a double
+/// Scalar). Integer adds also suit FPU-light targets (Cortex-M33
+/// single-precision) and SIMD lanes. Increments clamp to [0, 1) cycles per
+/// sample.
+template <> struct PhaseTraits<uint32_t> {
+  using Scalar = Real;
+
+  static SEA_INLINE uint32_t FromCycles(Scalar cycles) {
+    // Largest float below 1: its product with 2^32 (plus the rounding
+    // half) still fits.
+    constexpr Scalar kMaxCycles = static_cast<Scalar>(0.99999994f);
+    if (!(cycles > static_cast<Scalar>(0.0)))
+      return 0u;
+    if (cycles > kMaxCycles)
+      cycles = kMaxCycles;
+    return static_cast<uint32_t>(cycles * static_cast<Scalar>(4294967296.0) +
+                                 static_cast<Scalar>(0.5));
+  }
+
+  /// Converts the top bits that T represents exactly, so the result stays
+  /// below 1 and the conversion is a signed (single-instruction) one.
+  template <typename T> static SEA_INLINE T ToCycles(uint32_t phase) {
+    constexpr int kBits = std::numeric_limits<T>::digits < 31
+                              ? std::numeric_limits<T>::digits
+                              : 31;
+    constexpr T kScale = static_cast<T>(1.0) / static_cast<T>(1u << kBits);
+    return static_cast<T>(static_cast<int32_t>(phase >> (32 - kBits))) *
+           kScale;
+  }
+
+  static SEA_INLINE uint32_t Advance(uint32_t phase, uint32_t increment) {
+    return phase + increment;
+  }
+
+  /// Phase after n Advance() calls: n * increment mod 2^32, bit-exact.
+  static SEA_INLINE uint32_t AdvanceBy(uint32_t phase, uint32_t increment,
+                                       uint64_t n) {
+    return phase + increment * static_cast<uint32_t>(n);
+  }
+};
+
+} // namespace sea
@@ -0,0 +1,52 @@
+#pragma once
+#include "sea_platform.h"
+#include <cstddef>
+
+// Compile-time description of the host vector unit. SEA_DSP does not ship
+// hand-written intrinsics; lane-parallel kernels are written as fixed-width
+// loops over aligned arrays of kLanes<T> elements, which GCC/Clang/MSVC
+// turn into SSE/AVX/NEON code when the matching target flags are enabled.
+//
+//   ISA            register   float lanes   double lanes
+//   AVX/AVX2       256-bit    8             4
+//   SSE2 / NEON    128-bit    4             2
+//   none (M33)     scalar     1             1
+
+#if defined(__AVX__)
+#define SEA_SIMD_AVX 1
+#define SEA_SIMD_REGISTER_BYTES 32
+#elif defined(__SSE2__) || defined(_M_X64) ||                                 \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SEA_SIMD_SSE2 1
+#define SEA_SIMD_REGISTER_BYTES 16
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define SEA_SIMD_NEON 1
+#define SEA_SIMD_REGISTER_BYTES 16
+#else
+#define SEA_SIMD_REGISTER_BYTES 0
+#endif
+
+#if defined(_MSC_VER)
+#define SEA_RESTRICT __restrict
+#elif defined(__GNUC__) || defined(__clang__)
+#define SEA_RESTRICT __restrict__
+#else
+#define SEA_RESTRICT
+#endif
+
+namespace sea {
+namespace simd {
+
+constexpr size_t kRegisterBytes = SEA_SIMD_REGISTER_BYTES;
+
+// Alignment for lane-group arrays (at least one cache-friendly 16 bytes).
+constexpr size_t kAlignment = kRegisterBytes > 16 ? kRegisterBytes : 16;
+
+// Number of T values that fit in one vector register (1 when scalar).
+template <typename T>
+constexpr int kLanes =
+    (kRegisterBytes / sizeof(T)) > 0 ? static_cast<int>(kRegisterBytes / sizeof(T))
+                                     : 1;
+
+} // namespace simd
+} // namespace sea
@@ -31,8 +31,15 @@ public:
     }
 
     mK = Math::Clamp(k, static_cast<T>(0.0), static_cast<T>(1.98));
-    lpf1.Prepare(mCutoff);
-    lpf2.Prepare(mCutoff);
+    const T g = lpf1.ComputeG(mCutoff);
+    lpf1.SetG(g);
+    lpf2.SetG(g);
+  }
+
+  // See TPTIntegrator::SetCutoffTable().
+  void SetCutoffTable(const CutoffTable<T> *table) {
+    lpf1.SetCutoffTable(table);
+    lpf2.SetCutoffTable(table);
   }
 
   SEA_INLINE T Process(T in) {
@@ -1,4 +1,5 @@
 #pragma once
+#include "sea_coefficient_ramp.h"
 #include "sea_tpt_integrator.h"
 #include <algorithm>
 
@@ -12,6 +13,18 @@ public:
     T hp;
   };
 
+  // Everything Process() reads from SetParams(): integrator gain g and
+  // damping r = 1/(2Q).
+  struct Coefficients {
+    T g;
+    T r;
+
+    static Coefficients Lerp(const Coefficients &a, const Coefficients &b,
+                             T t) {
+      return {a.g + (b.g - a.g) * t, a.r + (b.r - a.r) * t};
+    }
+  };
+
   SVFilter() = default;
 
   void Init(T sampleRate) {
@@ -42,6 +55,33 @@ public:
     CalculateCoefficients();
   }
 
+  // Coefficients SetParams(cutoff, Q) would produce, without applying them.
+  Coefficients ComputeCoefficients(T cutoff, T Q) const {
+    T fc = cutoff;
+    if (mSampleRate <= static_cast<T>(0.0)) {
+      fc = static_cast<T>(0.0);
+    } else {
+      T nyquist = static_cast<T>(0.5) * mSampleRate;
+      T maxCutoff = nyquist * static_cast<T>(0.49);
+      fc = Math::Clamp(cutoff, static_cast<T>(0.0), maxCutoff);
+    }
+    T q = (Q < static_cast<T>(0.05)) ? static_cast<T>(0.05) : Q;
+    return {integrator1.ComputeG(fc),
+            static_cast<T>(1.0) / (static_cast<T>(2.0) * q)};
+  }
+
+  // See TPTIntegrator::SetCutoffTable().
+  void SetCutoffTable(const CutoffTable<T> *table) {
+    integrator1.SetCutoffTable(table);
+    integrator2.SetCutoffTable(table);
+  }
+
+  void SetCoefficients(const Coefficients &c) {
+    integrator1.SetG(c.g);
+    integrator2.SetG(c.g);
+    mR = c.r;
+  }
+
   SEA_INLINE Outputs Process(T in) {
     // This relies on Prepare happening in SetParams
     // Original implementation accessed g from integrator1
@@ -64,10 +104,38 @@ public:
   SEA_INLINE T ProcessBP(T in) { return Process(in).bp; }
   SEA_INLINE T ProcessHP(T in) { return Process(in).hp; }
 
+  // Low-pass output of n samples while the coefficients ramp from `from` to
+  // `to` (see ProcessRamped()).
+  void ProcessBlock(const T *in, T *out, int n, const Coefficients &from,
+                    const Coefficients &to, int rampPos = 0,
+                    int rampLength = 0) {
+    ProcessRamped(
+        in, out, n, from, to, rampPos, rampLength,
+        [this](const Coefficients &c) { SetCoefficients(c); },
+        [this](T x) { return ProcessLP(x); });
+  }
+
+  // Low-pass output of n samples with the cutoff ramping from cutoffStart
+  // to cutoffEnd (g computed at the ends only). A constant cutoff is
+  // SetParams() followed by per-sample ProcessLP().
+  void ProcessBlock(const T *in, T *out, int n, T cutoffStart, T cutoffEnd,
+                    T Q) {
+    if (cutoffStart == cutoffEnd) {
+      SetParams(cutoffEnd, Q);
+      for (int i = 0; i < n; ++i)
+        out[i] = ProcessLP(in[i]);
+      return;
+    }
+    ProcessBlock(in, out, n, ComputeCoefficients(cutoffStart, Q),
+                 ComputeCoefficients(cutoffEnd, Q));
+  }
+
 private:
+  // Both integrators share one g: compute it once.
   void CalculateCoefficients() {
-    integrator1.Prepare(mCutoff);
-    integrator2.Prepare(mCutoff);
+    const T g = integrator1.ComputeG(mCutoff);
+    integrator1.SetG(g);
+    integrator2.SetG(g);
   }
 
   T mSampleRate = static_cast<T>(44100.0);
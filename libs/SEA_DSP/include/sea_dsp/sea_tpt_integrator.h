@@ -1,4 +1,6 @@
 #pragma once
+#include "sea_cutoff_table.h"
+#include "sea_denormal.h"
 #include "sea_math.h"
 #include "sea_platform.h"
 
@@ -21,11 +23,13 @@ public:
 
   // Prepare the integrator for the current sample
   // cutoff: Cutoff frequency in Hz
-  SEA_INLINE void Prepare(T cutoff) {
-    if (mSampleRate <= static_cast<T>(0.0)) {
-      g = static_cast<T>(0.0);
-      return;
-    }
+  SEA_INLINE void Prepare(T cutoff) { g = ComputeG(cutoff); }
+
+  // Gain for a cutoff without touching the integrator (used to precompute
+  // coefficient targets for ramping).
+  SEA_INLINE T ComputeG(T cutoff) const {
+    if (mSampleRate <= static_cast<T>(0.0))
+      return static_cast<T>(0.0);
 
     // Clamp cutoff to prevent instability
     T nyquist = static_cast<T>(0.5) * mSampleRate;
@@ -36,12 +40,18 @@ public:
     else if (cutoff > maxCutoff)
       cutoff = maxCutoff;
 
+    if (mCutoffTable)
+      return mCutoffTable->Lookup(cutoff);
     T wd = static_cast<T>(kTwoPi) * cutoff;
     T wa = mTwoTimesSampleRate *
            Math::Tan(wd * mInvSampleRate * static_cast<T>(0.5));
-    g = wa * mInvSampleRate * static_cast<T>(0.5);
+    return wa * mInvSampleRate * static_cast<T>(0.5);
   }
 
+  // Reads g from a shared table instead of calling Tan (nullptr = exact).
+  // The table must outlive the integrator and match its sample rate.
+  void SetCutoffTable(const CutoffTable<T> *table) { mCutoffTable = table; }
+
   // Set g directly (avoids redundant Tan when caller has already computed it)
   SEA_INLINE void SetG(T newG) { g = newG; }
 
@@ -53,7 +63,7 @@ public:
 
     // Update state: s = g * in + y
     // Matches the original implementation logic: s = (sample_t)(g * in + y);
-    s = g * in + y;
+    s = UndenormalState(g * in + y);
 
     return y;
   }
@@ -65,12 +75,13 @@ public:
   SEA_INLINE T GetS() const { return s; }
 
   // Set the state S (needed for some ladder implementations)
-  SEA_INLINE void SetS(T newState) { s = newState; }
+  SEA_INLINE void SetS(T newState) { s = UndenormalState(newState); }
 
 private:
   T mSampleRate = static_cast<T>(44100.0);
   T mInvSampleRate = static_cast<T>(1.0) / static_cast<T>(44100.0);
   T mTwoTimesSampleRate = static_cast<T>(2.0) * static_cast<T>(44100.0);
+  const CutoffTable<T> *mCutoffTable = nullptr;
   T s = static_cast<T>(0.0); // State
   T g = static_cast<T>(0.0); // Instantaneous gain
 };
@@ -0,0 +1,236 @@
+#pragma once
+#include "sea_math.h"
+#include "sea_oscillator.h"
+#include "sea_platform.h"
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace sea {
+
+/// Band-limited single-cycle tables for saw and triangle, mip-mapped per
+/// octave, plus a sine. Level l holds kMaxHarmonics >> l harmonics, so level
+/// 0 is the full series and the last level a lone fundamental. Built once
+/// per process on the first Get() (~190 KB of float, heap allocated so
+/// targets that never use it pay nothing) and shared read-only by every
+/// oscillator in every plugin instance.
+class MipMappedWavetables {
+public:
+  static constexpr size_t kSize = 2048; // samples per cycle
+  static constexpr int kLevels = 11;
+  static constexpr size_t kMaxHarmonics = kSize / 2;
+
+  enum Shape { kSaw = 0, kTriangle, kSine }; // sine has a single level
+
+  /// The process-wide tables. The first call builds them (allocates, a few
+  /// ms): call it outside the audio thread, e.g. from Init().
+  static const MipMappedWavetables &Get() {
+    static const std::unique_ptr<const MipMappedWavetables> instance(
+        new MipMappedWavetables());
+    return *instance;
+  }
+
+  /// Fullest level whose highest harmonic stays below Nyquist at the given
+  /// phase increment (cycles per sample). Cheap enough to call per sample.
+  template <typename PhaseT> static int LevelFor(PhaseT increment) {
+    // Need (kMaxHarmonics >> l) * increment <= 0.5, i.e.
+    // l >= ceil(log2(2 * kMaxHarmonics * increment)), read straight from
+    // the IEEE-754 exponent and mantissa bits (no libm call per sample).
+    const double x =
+        static_cast<double>(2 * kMaxHarmonics) * static_cast<double>(increment);
+    if (!(x > 1.0))
+      return 0;
+    uint64_t bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+    const int exponent = static_cast<int>((bits >> 52) & 0x7ff) - 1023;
+    const bool exact = (bits & ((uint64_t(1) << 52) - 1)) == 0;
+    int level = exact ? exponent : exponent + 1;
+    if (level > kLevels - 1)
+      level = kLevels - 1;
+    return level;
+  }
+
+  /// kSize + 1 samples (the last repeats the first for interpolation).
+  const float *Table(Shape shape, int level) const {
+    return mData.data() + Offset(shape, level);
+  }
+
+  /// Linearly interpolated read at phase in [0, 1).
+  template <typename T, typename PhaseT>
+  static SEA_INLINE T Lookup(const float *table, PhaseT phase) {
+    const PhaseT pos = phase * static_cast<PhaseT>(kSize);
+    const int i = static_cast<int>(pos) & static_cast<int>(kSize - 1);
+    const T frac = static_cast<T>(pos - static_cast<PhaseT>(i));
+    const T a = static_cast<T>(table[i]);
+    const T b = static_cast<T>(table[i + 1]);
+    return a + frac * (b - a);
+  }
+
+private:
+  static constexpr size_t kNumTables = 2 * kLevels + 1;
+
+  static size_t Offset(Shape shape, int level) {
+    const size_t index = (shape == kSine)
+                             ? 2 * kLevels
+                             : static_cast<size_t>(shape) * kLevels +
+                                   static_cast<size_t>(level);
+    return index * (kSize + 1);
+  }
+
+  MipMappedWavetables() : mData(kNumTables * (kSize + 1), 0.0f) {
+    constexpr double kPiD = 3.14159265358979323846;
+    // sin(2*pi*k/kSize): harmonic n at sample i is sine[(n * i) % kSize].
+    std::vector<double> sine(kSize);
+    for (size_t k = 0; k < kSize; ++k)
+      sine[k] = std::sin(2.0 * kPiD * static_cast<double>(k) /
+                         static_cast<double>(kSize));
+
+    // Build from the top level down, each level adding the harmonics the
+    // one above lacks, so every harmonic is summed exactly once.
+    std::vector<double> saw(kSize, 0.0);
+    std::vector<double> tri(kSize, 0.0);
+    size_t done = 0;
+    for (int level = kLevels - 1; level >= 0; --level) {
+      const size_t harmonics = kMaxHarmonics >> level;
+      for (size_t n = done + 1; n <= harmonics; ++n) {
+        // 2p - 1 = -(2/pi) sum sin(2 pi n p) / n
+        const double sawGain = -2.0 / (kPiD * static_cast<double>(n));
+        // 4|p - 1/2| - 1 = (8/pi^2) sum_{n odd} cos(2 pi n p) / n^2
+        const double triGain =
+            (n & 1u) ? 8.0 / (kPiD * kPiD * static_cast<double>(n * n)) : 0.0;
+        for (size_t i = 0; i < kSize; ++i) {
+          const size_t k = (n * i) % kSize;
+          saw[i] += sawGain * sine[k];
+          tri[i] += triGain * sine[(k + kSize / 4) % kSize];
+        }
+      }
+      done = harmonics;
+      Store(kSaw, level, saw);
+      Store(kTriangle, level, tri);
+    }
+    Store(kSine, 0, sine);
+  }
+
+  void Store(Shape shape, int level, const std::vector<double> &cycle) {
+    float *table = mData.data() + Offset(shape, level);
+    for (size_t i = 0; i < kSize; ++i)
+      table[i] = static_cast<float>(cycle[i]);
+    table[kSize] = table[0];
+  }
+
+  std::vector<float> mData;
+};
+
+/// Band-limited oscillator reading the shared MipMappedWavetables: one
+/// interpolated table read per sample (two for square/pulse), no matter how
+/// fast the frequency is modulated. Square/pulse is the difference of two
+/// saw reads offset by the pulse width, so PWM needs no extra tables. Same
+/// interface as BasicOscillator; T/PhaseT as there.
+template <typename T = Real, typename PhaseT = T>
+class BasicWavetableOscillator {
+public:
+  using WaveformType = OscillatorWaveform;
+  using Tables = MipMappedWavetables;
+
+  BasicWavetableOscillator() = default;
+
+  /// Also builds the shared tables on first use; not realtime-safe the
+  /// first time it runs in a process.
+  void Init(T sampleRate) {
+    mTables = &Tables::Get();
+    mSampleRate = sampleRate;
+    mInvSampleRate = static_cast<PhaseT>(1.0) / static_cast<PhaseT>(sampleRate);
+    mPhase = static_cast<PhaseT>(0.0);
+    mPhaseIncrement = static_cast<PhaseT>(0.0);
+    SelectTable();
+  }
+
+  void Reset() { mPhase = static_cast<PhaseT>(0.0); }
+
+  /// Also picks the mip level; cheap enough for audio-rate FM. Negative
+  /// frequencies run the cycle backwards.
+  void SetFrequency(T freq) {
+    mPhaseIncrement = static_cast<PhaseT>(freq) * mInvSampleRate;
+    const int level = Tables::LevelFor(
+        mPhaseIncrement < static_cast<PhaseT>(0.0) ? -mPhaseIncrement
+                                                   : mPhaseIncrement);
+    if (level != mLevel) {
+      mLevel = level;
+      SelectTable();
+    }
+  }
+
+  void SetWaveform(WaveformType type) {
+    mWaveform = type;
+    SelectTable();
+  }
+
+  void SetPulseWidth(T pw) {
+    mPulseWidth =
+        Math::Clamp(pw, static_cast<T>(0.01), static_cast<T>(0.99));
+  }
+
+  T GetPhaseIncrement() const { return static_cast<T>(mPhaseIncrement); }
+  int GetLevel() const { return mLevel; }
+
+  /// Range: about [-1.1, 1.1] (band-limited edges ring). Silent until
+  /// Init().
+  SEA_INLINE T Process() {
+    if (!mTable)
+      return static_cast<T>(0.0);
+    T out = Tables::Lookup<T>(mTable, mPhase);
+    if (mWaveform == WaveformType::Square) {
+      // saw(p - pw) - saw(p) is 2 - 2pw before the edge at pw and -2pw
+      // after it; shifting by 2pw - 1 gives the +/-1 pulse.
+      const PhaseT shifted = Wrap(mPhase - static_cast<PhaseT>(mPulseWidth));
+      out = Tables::Lookup<T>(mTable, shifted) - out +
+            (static_cast<T>(2.0) * mPulseWidth - static_cast<T>(1.0));
+    }
+
+    mPhase = Wrap(mPhase + mPhaseIncrement);
+    return out;
+  }
+
+private:
+  // Brings a phase at most one cycle outside [0, 1) back into it. A tiny
+  // negative float phase plus 1 can round to exactly 1, which Lookup()
+  // would read as index 0 with a full-table fraction, so that maps to 0.
+  static SEA_INLINE PhaseT Wrap(PhaseT phase) {
+    if (phase >= static_cast<PhaseT>(1.0))
+      return phase - static_cast<PhaseT>(1.0);
+    if (phase < static_cast<PhaseT>(0.0)) {
+      phase += static_cast<PhaseT>(1.0);
+      if (phase >= static_cast<PhaseT>(1.0))
+        phase = static_cast<PhaseT>(0.0);
+    }
+    return phase;
+  }
+
+  void SelectTable() {
+    if (!mTables)
+      return;
+    Tables::Shape shape = Tables::kSaw;
+    if (mWaveform == WaveformType::Triangle)
+      shape = Tables::kTriangle;
+    else if (mWaveform == WaveformType::Sine)
+      shape = Tables::kSine;
+    mTable = mTables->Table(shape, mLevel);
+  }
+
+  const Tables *mTables = nullptr;
+  const float *mTable = nullptr;
+  int mLevel = 0;
+  T mSampleRate = static_cast<T>(44100.0);
+  PhaseT mInvSampleRate = static_cast<PhaseT>(1.0) / static_cast<PhaseT>(44100.0);
+  PhaseT mPhase = static_cast<PhaseT>(0.0);
+  PhaseT mPhaseIncrement = static_cast<PhaseT>(0.0);
+  T mPulseWidth = static_cast<T>(0.5);
+  WaveformType mWaveform = WaveformType::Saw;
+};
+
+using WavetableOscillator = BasicWavetableOscillator<Real>;
+
+} // namespace sea
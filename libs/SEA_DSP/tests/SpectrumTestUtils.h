@@ -0,0 +1,62 @@
+#pragma once
+// Spectrum helpers shared by the oscillator aliasing tests.
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace sea_test {
+
+// In-place radix-2 FFT (size must be a power of two).
+inline void Fft(std::vector<std::complex<double>> &x) {
+  const size_t n = x.size();
+  for (size_t i = 1, j = 0; i < n; ++i) {
+    size_t bit = n >> 1;
+    for (; j & bit; bit >>= 1)
+      j ^= bit;
+    j ^= bit;
+    if (i < j)
+      std::swap(x[i], x[j]);
+  }
+  for (size_t len = 2; len <= n; len <<= 1) {
+    const double angle = -2.0 * 3.14159265358979323846 / double(len);
+    const std::complex<double> wlen(std::cos(angle), std::sin(angle));
+    for (size_t i = 0; i < n; i += len) {
+      std::complex<double> w(1.0);
+      for (size_t k = 0; k < len / 2; ++k) {
+        const auto u = x[i + k];
+        const auto v = x[i + k + len / 2] * w;
+        x[i + k] = u + v;
+        x[i + k + len / 2] = u - v;
+        w *= wlen;
+      }
+    }
+  }
+}
+
+// Ratio (dB) of aliased to harmonic power in one cycle-aligned block. The
+// fundamental must sit exactly on FFT bin `bin` (pick an odd/prime bin so
+// folded harmonics land between true ones); then no window is needed and
+// every bin that is not a multiple of `bin` holds aliasing only. A non-zero
+// maxBin limits the sum to bins below it (e.g. the audible band).
+inline double AliasingDb(const std::vector<double> &signal, size_t bin,
+                         size_t maxBin = 0) {
+  std::vector<std::complex<double>> spectrum(signal.begin(), signal.end());
+  Fft(spectrum);
+  const size_t end = (maxBin > 0 && maxBin < spectrum.size() / 2)
+                         ? maxBin
+                         : spectrum.size() / 2;
+  double harmonic = 0.0;
+  double alias = 0.0;
+  for (size_t k = 1; k < end; ++k) {
+    const double p = std::norm(spectrum[k]);
+    if (k % bin == 0)
+      harmonic += p;
+    else
+      alias += p;
+  }
+  return 10.0 * std::log10(alias / harmonic);
+}
+
+} // namespace sea_test
@@ -95,3 +95,74 @@ TEST_CASE("ADSR parameter clamping is enforced", "[ADSR]") {
   REQUIRE(adsr.GetStage() == sea::ADSREnvelope::kIdle);
   REQUIRE(adsr.GetLevel() == Approx(0.0).margin(1e-12));
 }
+
+TEST_CASE("ADSR shared coefficients match own parameters", "[ADSR]") {
+  sea::ADSREnvelope own;
+  own.Init(48000.0);
+  own.SetParams(0.003, 0.02, 0.4, 0.01);
+
+  const auto shared = sea::ADSREnvelope::Coefficients::Compute(
+      0.003, 0.02, 0.4, 0.01, 48000.0);
+  sea::ADSREnvelope a;
+  sea::ADSREnvelope b;
+  a.Init(48000.0);
+  b.Init(48000.0);
+
+  own.NoteOn();
+  a.NoteOn(shared);
+  for (int i = 0; i < 2500; ++i) {
+    if (i == 1000) {
+      own.NoteOff();
+      a.NoteOff(shared);
+      b.NoteOn(shared); // independent state on the same coefficients
+    }
+    const auto expected = own.Process();
+    REQUIRE(a.Process(shared) == expected);
+    b.Process(shared);
+  }
+  REQUIRE(a.GetStage() == sea::ADSREnvelope::kIdle);
+  REQUIRE(b.GetStage() == sea::ADSREnvelope::kSustain);
+}
+
+TEST_CASE("ADSR Advance matches per-sample Process", "[ADSR]") {
+  const auto c = sea::ADSREnvelope::Coefficients::Compute(0.003, 0.02, 0.4,
+                                                          0.01, 48000.0);
+  // Skip lengths landing mid-attack, across decay into sustain, and far past
+  // the end of the release.
+  const int kSkips[] = {1, 37, 144, 1500, 20000};
+  for (int skip : kSkips) {
+    sea::ADSREnvelope stepped;
+    sea::ADSREnvelope skipped;
+    stepped.Init(48000.0);
+    skipped.Init(48000.0);
+    stepped.NoteOn(c);
+    skipped.NoteOn(c);
+    for (int i = 0; i < skip; ++i)
+      stepped.Process(c);
+    skipped.Advance(c, static_cast<uint64_t>(skip));
+    INFO("attack/decay skip " << skip);
+    REQUIRE(skipped.GetStage() == stepped.GetStage());
+    REQUIRE(skipped.GetLevel() == Approx(stepped.GetLevel()).margin(1e-9));
+
+    stepped.NoteOff(c);
+    skipped.NoteOff(c);
+    for (int i = 0; i < skip; ++i)
+      stepped.Process(c);
+    skipped.Advance(c, static_cast<uint64_t>(skip));
+    INFO("release skip " << skip);
+    REQUIRE(skipped.GetStage() == stepped.GetStage());
+    REQUIRE(skipped.GetLevel() == Approx(stepped.GetLevel()).margin(1e-9));
+  }
+
+  // Zero-length segments and a seek far past any realistic note length.
+  sea::ADSREnvelope instant;
+  instant.Init(48000.0);
+  instant.SetParams(0.0, 0.0, 0.6, 0.0);
+  instant.NoteOn();
+  instant.Advance(1ull << 40);
+  REQUIRE(instant.GetStage() == sea::ADSREnvelope::kSustain);
+  REQUIRE(instant.GetLevel() == Approx(0.6));
+  instant.NoteOff();
+  instant.Advance(1);
+  REQUIRE(instant.GetStage() == sea::ADSREnvelope::kIdle);
+}
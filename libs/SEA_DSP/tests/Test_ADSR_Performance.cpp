@@ -2,6 +2,7 @@
 #include <sea_dsp/sea_adsr.h>
 #include <chrono>
 #include <cmath>
+#include <vector>
 
 TEST_CASE("ADSR NoteOff Correctness", "[ADSR][Correctness]") {
   sea::ADSREnvelope adsr;
@@ -153,3 +154,137 @@ TEST_CASE("ADSR Performance Benchmark", "[ADSR][.benchmark]") {
   // Sanity check - should be very fast
   REQUIRE(duration.count() < 1000000); // Less than 1 second total
 }
+
+namespace {
+
+// Drives two envelopes through the same gate pattern, one with
+// ProcessBlock() in blocks of varying size and one with Process(), and
+// requires identical output. Gate changes land on block boundaries, as
+// they do in the engine.
+template <typename T>
+void CheckBlockMatchesProcess(T a, T d, T s, T r, T sampleRate) {
+  sea::BasicADSREnvelope<T> ref, blk;
+  for (auto *env : {&ref, &blk}) {
+    env->Init(sampleRate);
+    env->SetParams(a, d, s, r);
+  }
+  const int gateOn[] = {0, 9000, 15000};
+  const int gateOff[] = {6000, 9500, 40000};
+  std::vector<T> out(512);
+  int pos = 0;
+  int b = 0;
+  while (pos < 60000) {
+    for (int g : gateOn)
+      if (g == pos) {
+        ref.NoteOn();
+        blk.NoteOn();
+      }
+    for (int g : gateOff)
+      if (g == pos) {
+        ref.NoteOff();
+        blk.NoteOff();
+      }
+    int n = 1 + (b++ * 97) % 512;
+    for (int g : gateOn)
+      if (g > pos && g - pos < n)
+        n = g - pos;
+    for (int g : gateOff)
+      if (g > pos && g - pos < n)
+        n = g - pos;
+    blk.ProcessBlock(out.data(), n);
+    for (int i = 0; i < n; ++i)
+      REQUIRE(out[static_cast<size_t>(i)] == ref.Process());
+    REQUIRE(blk.GetStage() == ref.GetStage());
+    REQUIRE(blk.GetLevel() == ref.GetLevel());
+    pos += n;
+  }
+}
+
+} // namespace
+
+TEST_CASE("ADSR ProcessBlock matches per-sample Process",
+          "[ADSR][Correctness][Block]") {
+  SECTION("double, typical patch") {
+    CheckBlockMatchesProcess<double>(0.01, 0.1, 0.5, 0.2, 44100.0);
+  }
+  SECTION("float, typical patch") {
+    CheckBlockMatchesProcess<float>(0.01f, 0.1f, 0.5f, 0.2f, 48000.0f);
+  }
+  SECTION("float, long segments accumulate rounding") {
+    CheckBlockMatchesProcess<float>(0.7f, 0.4f, 0.3f, 0.6f, 48000.0f);
+  }
+  SECTION("zero-length segments") {
+    CheckBlockMatchesProcess<double>(0.0, 0.0, 0.8, 0.0, 48000.0);
+    CheckBlockMatchesProcess<float>(0.0f, 0.05f, 0.0f, 0.001f, 48000.0f);
+  }
+  SECTION("single-sample segments") {
+    CheckBlockMatchesProcess<double>(1.0 / 48000.0, 2.0 / 48000.0, 1.0,
+                                     1.0 / 48000.0, 48000.0);
+  }
+}
+
+TEST_CASE("ADSR ProcessBlock with shared coefficients", "[ADSR][Block]") {
+  using Env = sea::BasicADSREnvelope<float>;
+  const Env::Coefficients c =
+      Env::Coefficients::Compute(0.002f, 0.01f, 0.25f, 0.005f, 48000.0f);
+  Env ref, blk;
+  ref.Init(48000.0f);
+  blk.Init(48000.0f);
+  ref.NoteOn(c);
+  blk.NoteOn(c);
+  float out[64];
+  for (int b = 0; b < 40; ++b) {
+    if (b == 20) {
+      ref.NoteOff(c);
+      blk.NoteOff(c);
+    }
+    blk.ProcessBlock(c, out, 64);
+    for (int i = 0; i < 64; ++i)
+      REQUIRE(out[i] == ref.Process(c));
+  }
+  REQUIRE_FALSE(blk.IsActive());
+}
+
+// Benchmark test (informational, not a failure condition)
+TEST_CASE("ADSR ProcessBlock Benchmark", "[ADSR][.benchmark]") {
+  // One note cycle per pass: attack, decay, sustain and release.
+  using Env = sea::BasicADSREnvelope<float>;
+  constexpr int kBlock = 64;
+  constexpr int kBlocks = 2000;
+  constexpr int kRepeats = 20;
+  float out[kBlock];
+  volatile float sink = 0.0f;
+
+  auto run = [&](bool block) {
+    Env env;
+    env.Init(48000.0f);
+    env.SetParams(0.05f, 0.3f, 0.6f, 0.8f);
+    const auto start = std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < kRepeats; ++r) {
+      env.Reset();
+      env.NoteOn();
+      for (int b = 0; b < kBlocks; ++b) {
+        if (b == kBlocks / 2)
+          env.NoteOff();
+        if (block) {
+          env.ProcessBlock(out, kBlock);
+        } else {
+          for (int i = 0; i < kBlock; ++i)
+            out[i] = env.Process();
+        }
+        sink = sink + out[kBlock - 1];
+      }
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+    return static_cast<double>(
+               std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+                   .count()) /
+           static_cast<double>(kBlock * kBlocks * kRepeats);
+  };
+
+  const double perSample = run(false);
+  const double block = run(true);
+  WARN("ADSR ns per sample: Process() " << perSample << ", ProcessBlock() "
+                                        << block);
+  REQUIRE(block > 0.0);
+}
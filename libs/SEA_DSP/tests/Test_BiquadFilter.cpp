@@ -31,3 +31,17 @@ TEST_CASE("BiquadFilter Type Safety - Float vs Double", "[Filter][BiquadFilter][
   // Results should be very close (accounting for precision differences)
   REQUIRE(std::abs(static_cast<double>(outF) - outD) < 0.0001);
 }
+
+TEST_CASE("BiquadFilter SetCoefficients matches SetParams", "[Filter][BiquadFilter]") {
+  sea::BiquadFilter<double> direct, viaCoeffs;
+  direct.Init(48000.0);
+  viaCoeffs.Init(48000.0);
+  direct.SetParams(sea::FilterType::LowPass, 2500.0, 4.0);
+  viaCoeffs.SetCoefficients(
+      viaCoeffs.ComputeCoefficients(sea::FilterType::LowPass, 2500.0, 4.0));
+
+  for (int i = 0; i < 256; ++i) {
+    double in = (i % 32 < 16) ? 1.0 : -1.0;
+    REQUIRE(viaCoeffs.Process(in) == direct.Process(in));
+  }
+}
@@ -85,3 +85,18 @@ TEST_CASE("CascadeFilter Type Safety", "[Filter][Cascade][TypeSafety]") {
   // Results should be close
   REQUIRE(std::abs(static_cast<double>(outF) - outD) < 0.01);
 }
+
+TEST_CASE("CascadeFilter SetCoefficients matches SetParams", "[Filter][Cascade]") {
+  using CF = sea::CascadeFilter<double>;
+  CF direct, viaCoeffs;
+  direct.Init(48000.0);
+  viaCoeffs.Init(48000.0);
+  direct.SetParams(900.0, 0.6, CF::Slope::dB24);
+  viaCoeffs.SetCoefficients(viaCoeffs.ComputeCoefficients(900.0, 0.6),
+                            CF::Slope::dB24);
+
+  for (int i = 0; i < 256; ++i) {
+    double in = (i % 40 < 20) ? 0.8 : -0.8;
+    REQUIRE(viaCoeffs.Process(in) == direct.Process(in));
+  }
+}
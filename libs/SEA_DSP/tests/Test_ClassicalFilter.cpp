@@ -1,6 +1,8 @@
 #include "catch.hpp"
 // IMPORTANT: Include sea_classical_filter.h FIRST to verify it's self-contained
 #include <sea_dsp/sea_classical_filter.h>
+#include <cmath>
+#include <vector>
 
 TEST_CASE("ClassicalFilter Self-Contained Header", "[Filter][Classical][Regression]") {
   // This test verifies that sea_classical_filter.h can be compiled in isolation
@@ -12,7 +14,7 @@ TEST_CASE("ClassicalFilter Self-Contained Header", "[Filter][Classical][Regressi
   // However, it's good practice to include headers for symbols you use directly.
   //
   // This test primarily ensures the header is self-contained and includes
-  // its direct dependencies (sea_svf.h, algorithm, cmath, vector).
+  // its direct dependencies (sea_svf.h, algorithm, cmath).
 
   sea::ClassicalFilter<double> filter;
   filter.Init(48000.0);
@@ -68,3 +70,67 @@ TEST_CASE("ClassicalFilter Chebyshev1 Response", "[Filter][Classical]") {
   REQUIRE(dcOut > 0.5);
   REQUIRE(dcOut < 1.5);
 }
+
+TEST_CASE("ClassicalFilter order is clamped to MaxOrder",
+          "[Filter][Classical]") {
+  sea::ClassicalFilter<double, 4> filter;
+  filter.Init(48000.0);
+  filter.SetConfig(sea::ClassicalFilter<double, 4>::Type::Butterworth, 12, 1.0);
+  REQUIRE(filter.GetOrder() == 4);
+  filter.SetConfig(sea::ClassicalFilter<double, 4>::Type::Butterworth, 3, 1.0);
+  REQUIRE(filter.GetOrder() == 4);
+  filter.SetConfig(sea::ClassicalFilter<double, 4>::Type::Chebyshev1, 1, 1.0);
+  REQUIRE(filter.GetOrder() == 2);
+}
+
+TEST_CASE("ClassicalFilter ProcessBlock matches per-sample Process",
+          "[Filter][Classical][Block]") {
+  // Order and type change between blocks, as they would from the UI.
+  using Filter = sea::ClassicalFilter<float>;
+  Filter ref, blk;
+  for (Filter *f : {&ref, &blk}) {
+    f->Init(48000.0f);
+    f->SetCutoff(2000.0f);
+  }
+  const struct {
+    Filter::Type type;
+    int order;
+  } configs[] = {{Filter::Type::Butterworth, 2},
+                 {Filter::Type::Chebyshev1, 8},
+                 {Filter::Type::Chebyshev2, 6},
+                 {Filter::Type::Butterworth, 4}};
+
+  std::vector<float> in(256), out(256);
+  for (size_t i = 0; i < in.size(); ++i)
+    in[i] = std::sin(0.05f * static_cast<float>(i)) +
+            0.3f * std::sin(1.3f * static_cast<float>(i));
+  for (const auto &c : configs) {
+    ref.SetConfig(c.type, c.order, 0.5f);
+    blk.SetConfig(c.type, c.order, 0.5f);
+    for (int b = 0; b < 8; ++b) {
+      const int n = 1 + (b * 53) % 256;
+      if (b % 2 == 0) {
+        blk.ProcessBlock(in.data(), out.data(), n);
+      } else {
+        std::copy(in.begin(), in.begin() + n, out.begin());
+        blk.ProcessBlock(out.data(), out.data(), n);
+      }
+      for (int i = 0; i < n; ++i)
+        REQUIRE(out[static_cast<size_t>(i)] ==
+                ref.Process(in[static_cast<size_t>(i)]));
+    }
+  }
+}
+
+TEST_CASE("ClassicalFilter passes through before SetConfig",
+          "[Filter][Classical][Block]") {
+  sea::ClassicalFilter<double> filter;
+  filter.Init(48000.0);
+  const double in[3] = {0.25, -0.5, 1.0};
+  double out[3];
+  filter.ProcessBlock(in, out, 3);
+  for (int i = 0; i < 3; ++i) {
+    REQUIRE(out[i] == in[i]);
+    REQUIRE(filter.Process(in[i]) == in[i]);
+  }
+}
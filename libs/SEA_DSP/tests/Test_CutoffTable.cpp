@@ -0,0 +1,230 @@
+#include "catch.hpp"
+#include <sea_dsp/sea_biquad_filter.h>
+#include <sea_dsp/sea_cascade_filter.h>
+#include <sea_dsp/sea_cutoff_table.h>
+#include <sea_dsp/sea_ladder_filter.h>
+#include <sea_dsp/sea_svf.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace {
+
+constexpr double kPiD = 3.14159265358979323846;
+
+// Cutoff (in cents) whose exact g is the table's g, relative to the one
+// asked for: the audible size of the interpolation error.
+double CentsError(double g, double cutoff, double sampleRate) {
+  const double equivalent = std::atan(g) * sampleRate / kPiD;
+  return 1200.0 * std::log2(equivalent / cutoff);
+}
+
+double RelError(double a, double b) {
+  return std::abs(a - b) / std::max(std::abs(b), 1e-12);
+}
+
+} // namespace
+
+TEST_CASE("CutoffTable tracks tan(pi fc / fs)", "[Filter][CutoffTable]") {
+  for (double fs : {44100.0, 48000.0, 96000.0, 192000.0}) {
+    sea::CutoffTable<double> table;
+    table.Init(fs);
+    double worstAudible = 0.0; // up to 10 kHz
+    double worst = 0.0;        // up to the 0.475 fs clamp
+    for (double fc = 20.0; fc < 0.475 * fs; fc *= 1.0007) {
+      const double cents = std::abs(CentsError(table.Lookup(fc), fc, fs));
+      worst = std::max(worst, cents);
+      if (fc <= 10000.0)
+        worstAudible = std::max(worstAudible, cents);
+    }
+    INFO("fs " << fs << ": " << worstAudible << " cents to 10 kHz, "
+               << worst << " cents to 0.475 fs");
+    CHECK(worstAudible < 0.1);
+    CHECK(worst < 2.0);
+  }
+
+  sea::CutoffTable<double> table;
+  table.Init(48000.0);
+  CHECK(table.Lookup(0.0) == 0.0);
+  CHECK(table.Lookup(-5.0) == 0.0);
+  // Below the first entry tan is linear in the cutoff.
+  CHECK(RelError(table.Lookup(2.0), std::tan(kPiD * 2.0 / 48000.0)) < 1e-6);
+  // Exactly on an entry there is nothing to interpolate.
+  CHECK(RelError(table.Lookup(1024.0), std::tan(kPiD * 1024.0 / 48000.0)) <
+        1e-15);
+}
+
+TEST_CASE("CutoffTable float lookup matches double",
+          "[Filter][CutoffTable]") {
+  sea::CutoffTable<float> f;
+  sea::CutoffTable<double> d;
+  f.Init(48000.0f);
+  d.Init(48000.0);
+  for (float fc = 20.0f; fc < 22000.0f; fc *= 1.01f) {
+    const double ref = d.Lookup(static_cast<double>(fc));
+    CHECK(RelError(static_cast<double>(f.Lookup(fc)), ref) < 1e-5);
+  }
+}
+
+TEST_CASE("Filters read cutoff coefficients from the table",
+          "[Filter][CutoffTable]") {
+  constexpr double kFs = 48000.0;
+  sea::CutoffTable<double> table;
+  table.Init(kFs);
+
+  // Coefficients within 1e-3 of the exact formulas across the audible
+  // range (1e-4 relative in g is about 0.1 cent).
+  constexpr double kTol = 1e-3;
+  for (double fc = 20.0; fc < 10000.0; fc *= 1.05) {
+    INFO("cutoff " << fc);
+    sea::LadderFilter<double> exactLadder, tableLadder;
+    exactLadder.Init(kFs);
+    tableLadder.Init(kFs);
+    tableLadder.SetCutoffTable(&table);
+    const auto le = exactLadder.ComputeCoefficients(fc, 0.7);
+    const auto lt = tableLadder.ComputeCoefficients(fc, 0.7);
+    CHECK(RelError(lt.g, le.g) < kTol);
+    CHECK(RelError(lt.inv1PlusG, le.inv1PlusG) < kTol);
+    CHECK(RelError(lt.invFeedbackDenom, le.invFeedbackDenom) < kTol);
+
+    sea::CascadeFilter<double> exactCascade, tableCascade;
+    exactCascade.Init(kFs);
+    tableCascade.Init(kFs);
+    tableCascade.SetCutoffTable(&table);
+    const auto ce = exactCascade.ComputeCoefficients(fc, 0.5);
+    const auto ct = tableCascade.ComputeCoefficients(fc, 0.5);
+    CHECK(RelError(ct.stage.g, ce.stage.g) < kTol);
+    CHECK(ct.stage.r == ce.stage.r);
+
+    for (sea::FilterType type :
+         {sea::FilterType::LowPass, sea::FilterType::HighPass,
+          sea::FilterType::BandPass, sea::FilterType::Notch}) {
+      sea::BiquadFilter<double> exactBiquad, tableBiquad;
+      exactBiquad.Init(kFs);
+      tableBiquad.Init(kFs);
+      tableBiquad.SetCutoffTable(&table);
+      const auto be = exactBiquad.ComputeCoefficients(type, fc, 2.0);
+      const auto bt = tableBiquad.ComputeCoefficients(type, fc, 2.0);
+      INFO("type " << static_cast<int>(type));
+      // Feedback terms sit near -2 and 1; feed-forward terms scale with the
+      // response, so compare them to the largest one.
+      const double scale =
+          std::max({std::abs(be.a0), std::abs(be.a1), std::abs(be.a2)});
+      CHECK(std::abs(bt.a0 - be.a0) < kTol * scale);
+      CHECK(std::abs(bt.a1 - be.a1) < kTol * scale);
+      CHECK(std::abs(bt.a2 - be.a2) < kTol * scale);
+      CHECK(std::abs(bt.b1 - be.b1) < 1e-4);
+      CHECK(std::abs(bt.b2 - be.b2) < 1e-4);
+    }
+  }
+}
+
+TEST_CASE("Table-driven filters follow a cutoff sweep",
+          "[Filter][CutoffTable]") {
+  constexpr double kFs = 48000.0;
+  sea::CutoffTable<double> table;
+  table.Init(kFs);
+  sea::LadderFilter<double> exactLadder, tableLadder;
+  sea::SVFilter<double> exactSvf, tableSvf;
+  sea::BiquadFilter<double> exactBiquad, tableBiquad;
+  for (auto *f : {&exactLadder, &tableLadder})
+    f->Init(kFs);
+  for (auto *f : {&exactSvf, &tableSvf})
+    f->Init(kFs);
+  for (auto *f : {&exactBiquad, &tableBiquad})
+    f->Init(kFs);
+  tableLadder.SetCutoffTable(&table);
+  tableSvf.SetCutoffTable(&table);
+  tableBiquad.SetCutoffTable(&table);
+
+  double maxErr = 0.0;
+  for (int i = 0; i < 48000; ++i) {
+    // Exponential envelope-style sweep, 50 Hz -> 12 kHz, per sample.
+    const double fc = 50.0 * std::pow(240.0, double(i % 4800) / 4800.0);
+    const double in = std::sin(2.0 * kPiD * 110.0 * i / kFs);
+    exactLadder.SetParams(sea::LadderFilter<double>::Model::Transistor, fc,
+                          0.5);
+    tableLadder.SetParams(sea::LadderFilter<double>::Model::Transistor, fc,
+                          0.5);
+    exactSvf.SetParams(fc, 1.0);
+    tableSvf.SetParams(fc, 1.0);
+    exactBiquad.SetParams(sea::FilterType::LowPass, fc, 1.0);
+    tableBiquad.SetParams(sea::FilterType::LowPass, fc, 1.0);
+    maxErr = std::max(maxErr, std::abs(tableLadder.Process(in) -
+                                       exactLadder.Process(in)));
+    maxErr = std::max(maxErr, std::abs(tableSvf.ProcessLP(in) -
+                                       exactSvf.ProcessLP(in)));
+    maxErr = std::max(maxErr, std::abs(tableBiquad.Process(in) -
+                                       exactBiquad.Process(in)));
+  }
+  INFO("max sample error " << maxErr);
+  CHECK(maxErr < 1e-3);
+}
+
+namespace {
+
+template <typename Filter, typename SetFn>
+double ModulatedNsPerSample(Filter &filter, SetFn set) {
+  constexpr int kSamples = 48000 * 10;
+  using Real = sea::Real;
+  volatile Real sink = 0;
+  Real fc = static_cast<Real>(200.0);
+  const Real ratio = static_cast<Real>(1.0001);
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  for (int i = 0; i < kSamples; ++i) {
+    fc = (fc > static_cast<Real>(15000.0)) ? static_cast<Real>(200.0)
+                                           : fc * ratio;
+    set(filter, fc);
+    sink = sink + filter.Process(static_cast<Real>(i & 31) *
+                                 static_cast<Real>(0.03));
+  }
+  const auto t1 = std::chrono::high_resolution_clock::now();
+  (void)sink;
+  return static_cast<double>(
+             std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0)
+                 .count()) /
+         kSamples;
+}
+
+} // namespace
+
+// Benchmark test (informational, not a failure condition)
+TEST_CASE("CutoffTable modulated filter benchmark",
+          "[Filter][CutoffTable][.benchmark]") {
+  using Real = sea::Real;
+  const Real fs = static_cast<Real>(48000.0);
+  sea::CutoffTable<Real> table;
+  table.Init(fs);
+  auto ladderSet = [](sea::LadderFilter<Real> &f, Real fc) {
+    f.SetParams(sea::LadderFilter<Real>::Model::Transistor, fc,
+                static_cast<Real>(0.5));
+  };
+  auto cascadeSet = [](sea::CascadeFilter<Real> &f, Real fc) {
+    f.SetParams(fc, static_cast<Real>(0.5),
+                sea::CascadeFilter<Real>::Slope::dB24);
+  };
+  auto biquadSet = [](sea::BiquadFilter<Real> &f, Real fc) {
+    f.SetParams(sea::FilterType::LowPass, fc, static_cast<Real>(1.0));
+  };
+  double ns[3][2];
+  for (int m = 0; m < 2; ++m) {
+    const sea::CutoffTable<Real> *t = (m == 1) ? &table : nullptr;
+    sea::LadderFilter<Real> ladder;
+    sea::CascadeFilter<Real> cascade;
+    sea::BiquadFilter<Real> biquad;
+    ladder.Init(fs);
+    cascade.Init(fs);
+    biquad.Init(fs);
+    ladder.SetCutoffTable(t);
+    cascade.SetCutoffTable(t);
+    biquad.SetCutoffTable(t);
+    ns[0][m] = ModulatedNsPerSample(ladder, ladderSet);
+    ns[1][m] = ModulatedNsPerSample(cascade, cascadeSet);
+    ns[2][m] = ModulatedNsPerSample(biquad, biquadSet);
+  }
+  WARN("per-sample cutoff modulation, ns/sample exact -> table: ladder "
+       << ns[0][0] << " -> " << ns[0][1] << ", cascade " << ns[1][0]
+       << " -> " << ns[1][1] << ", biquad " << ns[2][0] << " -> "
+       << ns[2][1]);
+  SUCCEED();
+}
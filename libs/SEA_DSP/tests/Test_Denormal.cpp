@@ -0,0 +1,120 @@
+#include "catch.hpp"
+#include <sea_dsp/sea_denormal.h>
+#include <sea_dsp/sea_ladder_filter.h>
+#include <sea_dsp/sea_one_pole_filter.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+
+namespace {
+
+// Halving the smallest normal float yields a subnormal unless FTZ is on.
+float HalfOfSmallestNormal() {
+  volatile float tiny = std::numeric_limits<float>::min();
+  return tiny * 0.5f;
+}
+
+} // namespace
+
+TEST_CASE("ScopedFlushDenormals flushes and restores", "[Denormal]") {
+  if (!sea::ScopedFlushDenormals::IsSupported())
+    return;
+
+  REQUIRE(std::fpclassify(HalfOfSmallestNormal()) == FP_SUBNORMAL);
+  {
+    sea::ScopedFlushDenormals outer;
+    REQUIRE(HalfOfSmallestNormal() == 0.0f);
+    {
+      sea::ScopedFlushDenormals inner;
+      REQUIRE(HalfOfSmallestNormal() == 0.0f);
+    }
+    REQUIRE(HalfOfSmallestNormal() == 0.0f);
+  }
+  REQUIRE(std::fpclassify(HalfOfSmallestNormal()) == FP_SUBNORMAL);
+}
+
+TEST_CASE("FlushDenormal zeroes only negligible values", "[Denormal]") {
+  REQUIRE(sea::FlushDenormal(std::numeric_limits<float>::denorm_min()) == 0.0f);
+  REQUIRE(sea::FlushDenormal(-1e-20) == 0.0);
+  REQUIRE(sea::FlushDenormal(1e-12) == 1e-12);
+  REQUIRE(sea::FlushDenormal(-0.5f) == -0.5f);
+}
+
+TEST_CASE("Filter tails decay to zero under the guard", "[Denormal]") {
+  if (!sea::ScopedFlushDenormals::IsSupported())
+    return;
+
+  sea::ScopedFlushDenormals noDenormals;
+  sea::LadderFilter<float> ladder;
+  ladder.Init(48000.0f);
+  ladder.SetParams(sea::LadderFilter<float>::Model::Transistor, 200.0f, 0.3f);
+  sea::OnePoleFilter<float> onePole;
+  onePole.Init(48000.0f);
+  onePole.SetCutoff(50.0f);
+
+  ladder.Process(1.0f);
+  onePole.Process(1.0f);
+  for (int i = 0; i < 48000; ++i) {
+    const float l = ladder.Process(0.0f);
+    const float o = onePole.Process(0.0f);
+    REQUIRE(std::fpclassify(l) != FP_SUBNORMAL);
+    REQUIRE(std::fpclassify(o) != FP_SUBNORMAL);
+  }
+}
+
+namespace {
+
+// A bank of low-cutoff filters excited once and then left to ring out, as
+// in a voice release tail: the states spend thousands of samples in the
+// subnormal range before reaching zero.
+double RenderReleaseTailUs(bool flush) {
+  constexpr int kFilters = 32;
+  constexpr int kSamples = 48000 * 4;
+  sea::LadderFilter<float> ladders[kFilters];
+  sea::OnePoleFilter<float> onePoles[kFilters];
+  for (int f = 0; f < kFilters; ++f) {
+    ladders[f].Init(48000.0f);
+    ladders[f].SetParams(sea::LadderFilter<float>::Model::Transistor,
+                         20.0f + 2.0f * static_cast<float>(f), 0.2f);
+    onePoles[f].Init(48000.0f);
+    onePoles[f].SetCutoff(5.0f + static_cast<float>(f));
+    ladders[f].Process(1.0f);
+    onePoles[f].Process(1.0f);
+  }
+
+  volatile float sink = 0.0f;
+  auto render = [&] {
+    for (int i = 0; i < kSamples; ++i) {
+      float acc = 0.0f;
+      for (int f = 0; f < kFilters; ++f)
+        acc += ladders[f].Process(0.0f) + onePoles[f].Process(0.0f);
+      sink = sink + acc;
+    }
+  };
+
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  if (flush) {
+    sea::ScopedFlushDenormals noDenormals;
+    render();
+  } else {
+    render();
+  }
+  const auto t1 = std::chrono::high_resolution_clock::now();
+  (void)sink;
+  return static_cast<double>(
+      std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count());
+}
+
+} // namespace
+
+// Benchmark test (informational, not a failure condition)
+TEST_CASE("Denormal release tail benchmark", "[Denormal][.benchmark]") {
+  const double plain = RenderReleaseTailUs(false);
+  const double flushed = RenderReleaseTailUs(true);
+  WARN("32 ladder + 32 one-pole tails, 4 s: " << plain << " us unguarded, "
+       << flushed << " us with ScopedFlushDenormals ("
+       << (plain / std::max(1.0, flushed)) << "x), injection="
+       << SEA_DENORMAL_INJECTION);
+  SUCCEED();
+}
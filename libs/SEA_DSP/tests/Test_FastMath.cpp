@@ -0,0 +1,263 @@
+#include "catch.hpp"
+#include <sea_dsp/sea_fast_math.h>
+#include <sea_dsp/sea_ladder_filter_lanes.h>
+#include <chrono>
+#include <cmath>
+#include <sstream>
+#include <vector>
+
+namespace {
+
+enum class Func { Tanh, Exp2, Sin, Cos, Tan, Log2 };
+
+const char *FuncName(Func f) {
+  switch (f) {
+  case Func::Tanh:
+    return "tanh";
+  case Func::Exp2:
+    return "exp2";
+  case Func::Sin:
+    return "sin";
+  case Func::Cos:
+    return "cos";
+  case Func::Tan:
+    return "tan";
+  case Func::Log2:
+    return "log2";
+  }
+  return "";
+}
+
+// Inputs spanning each function's documented domain.
+template <typename T> std::vector<T> Domain(Func f) {
+  constexpr int kN = 20001;
+  std::vector<T> x(kN);
+  for (int i = 0; i < kN; ++i) {
+    const double u = static_cast<double>(i) / (kN - 1); // [0, 1]
+    double v = 0.0;
+    switch (f) {
+    case Func::Tanh:
+      v = -8.0 + 16.0 * u;
+      break;
+    case Func::Exp2:
+      v = -30.0 + 60.0 * u;
+      break;
+    case Func::Sin:
+    case Func::Cos:
+      v = (-4.0 + 8.0 * u) * 6.283185307179586;
+      break;
+    case Func::Tan:
+      v = (-1.0 + 2.0 * u) * 1.5; // up to 0.48 fs for prewarping
+      break;
+    case Func::Log2:
+      v = std::exp2(-30.0 + 60.0 * u);
+      break;
+    }
+    x[static_cast<size_t>(i)] = static_cast<T>(v);
+  }
+  return x;
+}
+
+double Reference(Func f, double x) {
+  switch (f) {
+  case Func::Tanh:
+    return std::tanh(x);
+  case Func::Exp2:
+    return std::exp2(x);
+  case Func::Sin:
+    return std::sin(x);
+  case Func::Cos:
+    return std::cos(x);
+  case Func::Tan:
+    return std::tan(x);
+  case Func::Log2:
+    return std::log2(x);
+  }
+  return 0.0;
+}
+
+bool IsRelative(Func f) { return f == Func::Exp2 || f == Func::Tan; }
+
+template <typename M, typename T> void Apply(Func f, const T *in, T *out, int n) {
+  switch (f) {
+  case Func::Tanh:
+    M::Tanh(in, out, n);
+    break;
+  case Func::Exp2:
+    M::Exp2(in, out, n);
+    break;
+  case Func::Sin:
+    M::Sin(in, out, n);
+    break;
+  case Func::Cos:
+    M::Cos(in, out, n);
+    break;
+  case Func::Tan:
+    M::Tan(in, out, n);
+    break;
+  case Func::Log2:
+    M::Log2(in, out, n);
+    break;
+  }
+}
+
+template <typename M, typename T> T ApplyScalar(Func f, T x) {
+  switch (f) {
+  case Func::Tanh:
+    return M::Tanh(x);
+  case Func::Exp2:
+    return M::Exp2(x);
+  case Func::Sin:
+    return M::Sin(x);
+  case Func::Cos:
+    return M::Cos(x);
+  case Func::Tan:
+    return M::Tan(x);
+  case Func::Log2:
+    return M::Log2(x);
+  }
+  return x;
+}
+
+// Largest absolute (or, for exp2 and tan, relative) error against double
+// libm evaluated at the same T inputs.
+template <typename M, typename T> double MaxError(Func f) {
+  const std::vector<T> x = Domain<T>(f);
+  std::vector<T> y(x.size());
+  Apply<M>(f, x.data(), y.data(), static_cast<int>(x.size()));
+  double maxErr = 0.0;
+  for (size_t i = 0; i < x.size(); ++i) {
+    const double ref = Reference(f, static_cast<double>(x[i]));
+    double err = std::abs(static_cast<double>(y[i]) - ref);
+    if (IsRelative(f))
+      err /= std::abs(ref);
+    maxErr = std::max(maxErr, err);
+  }
+  return maxErr;
+}
+
+const Func kFuncs[] = {Func::Tanh, Func::Sin, Func::Cos,
+                       Func::Tan,  Func::Exp2, Func::Log2};
+
+template <typename T> void CheckTiers() {
+  for (Func f : kFuncs) {
+    const double exact = MaxError<sea::ExactMath, T>(f);
+    const double fast = MaxError<sea::FastMath, T>(f);
+    const double coarse = MaxError<sea::CoarseMath, T>(f);
+    INFO(FuncName(f) << " (" << sizeof(T) * 8 << "-bit): exact " << exact
+                     << ", fast " << fast << ", coarse " << coarse);
+    CHECK(exact < 1e-6);
+    CHECK(fast < 1e-4);
+    CHECK(coarse < 1e-2);
+  }
+}
+
+} // namespace
+
+TEST_CASE("TieredMath accuracy table", "[FastMath]") {
+  SECTION("float") { CheckTiers<float>(); }
+  SECTION("double") { CheckTiers<double>(); }
+}
+
+TEST_CASE("TieredMath array versions match the scalar kernels",
+          "[FastMath]") {
+  // Odd length exercises the scalar tail after the lane groups.
+  for (Func f : kFuncs) {
+    std::vector<float> x = Domain<float>(f);
+    x.resize(1001);
+    std::vector<float> y(x.size());
+    Apply<sea::FastMath>(f, x.data(), y.data(), static_cast<int>(x.size()));
+    for (size_t i = 0; i < x.size(); ++i)
+      REQUIRE(y[i] == ApplyScalar<sea::FastMath>(f, x[i]));
+
+    std::vector<float> inPlace = x;
+    Apply<sea::CoarseMath>(f, inPlace.data(), inPlace.data(),
+                           static_cast<int>(inPlace.size()));
+    for (size_t i = 0; i < x.size(); ++i)
+      REQUIRE(inPlace[i] == ApplyScalar<sea::CoarseMath>(f, x[i]));
+  }
+}
+
+TEST_CASE("TieredMath edge cases", "[FastMath]") {
+  // Tanh saturates exactly; Exp2 and Log2 clamp instead of overflowing.
+  CHECK(sea::FastMath::Tanh(100.0f) == Approx(1.0f).margin(1e-6));
+  CHECK(sea::CoarseMath::Tanh(-1e30) == Approx(-1.0).margin(1e-6));
+  CHECK(std::isfinite(sea::FastMath::Exp2(1000.0f)));
+  CHECK(sea::FastMath::Exp2(-1000.0f) > 0.0f);
+  CHECK(sea::FastMath::Log2(1.0f) == Approx(0.0f).margin(1e-4));
+  CHECK(sea::CoarseMath::Log2(1024.0) == Approx(10.0).margin(1e-2));
+  CHECK(sea::FastMath::Sin(0.0) == 0.0);
+  CHECK(sea::FastMath::Tan(0.0f) == 0.0f);
+}
+
+TEST_CASE("Ladder with FastMath tracks the default ladder",
+          "[FastMath][LadderFilter]") {
+  // The math policy swaps Tan and the per-sample Tanh stages; LadderFilterLanes
+  // with the same policy stays bit-identical to its scalar ladder.
+  sea::LadderFilter<double> reference;
+  sea::LadderFilter<double, sea::FastMath> fast;
+  sea::LadderFilter<float, sea::FastMath> fastFloat;
+  sea::LadderFilterLanes<float, 4, sea::FastMath> lanes;
+  reference.Init(48000.0);
+  fast.Init(48000.0);
+  fastFloat.Init(48000.0f);
+  reference.SetParams(sea::LadderFilter<double>::Model::Transistor, 1200.0,
+                      0.7);
+  fast.SetParams(sea::LadderFilter<double, sea::FastMath>::Model::Transistor,
+                 1200.0, 0.7);
+  fastFloat.SetParams(
+      sea::LadderFilter<float, sea::FastMath>::Model::Transistor, 1200.0f,
+      0.7f);
+  for (int l = 0; l < 4; ++l)
+    lanes.Load(l, fastFloat);
+
+  double maxDiff = 0.0;
+  for (int i = 0; i < 4800; ++i) {
+    const double x = 1.5 * std::sin(2.0 * 3.141592653589793 * 110.0 * i /
+                                    48000.0);
+    maxDiff = std::max(maxDiff, std::abs(fast.Process(x) - reference.Process(x)));
+
+    const float in[4] = {static_cast<float>(x), static_cast<float>(x),
+                         static_cast<float>(x), static_cast<float>(x)};
+    float out[4];
+    lanes.Process(in, out);
+    const float scalar = fastFloat.Process(static_cast<float>(x));
+    for (int l = 0; l < 4; ++l)
+      REQUIRE(out[l] == scalar);
+  }
+  CHECK(maxDiff < 1e-3);
+}
+
+namespace {
+
+template <typename M> double NsPerElement(Func f) {
+  constexpr int kN = 4096;
+  constexpr int kRepeats = 200;
+  const std::vector<float> x = Domain<float>(f);
+  std::vector<float> in(x.begin(), x.begin() + kN), out(kN);
+  volatile float sink = 0.0f;
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  for (int r = 0; r < kRepeats; ++r) {
+    Apply<M>(f, in.data(), out.data(), kN);
+    sink = sink + out[static_cast<size_t>(r)];
+  }
+  const auto t1 = std::chrono::high_resolution_clock::now();
+  return static_cast<double>(
+             std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0)
+                 .count()) /
+         static_cast<double>(kN * kRepeats);
+}
+
+} // namespace
+
+// Benchmark test (informational, not a failure condition)
+TEST_CASE("TieredMath ns per element benchmark", "[FastMath][.benchmark]") {
+  std::ostringstream table;
+  table << "float ns/element (exact / fast / coarse):";
+  for (Func f : kFuncs) {
+    table << "\n  " << FuncName(f) << ": " << NsPerElement<sea::ExactMath>(f)
+          << " / " << NsPerElement<sea::FastMath>(f) << " / "
+          << NsPerElement<sea::CoarseMath>(f);
+  }
+  WARN(table.str());
+}
@@ -0,0 +1,190 @@
+#include "catch.hpp"
+#include <sea_dsp/sea_biquad_filter.h>
+#include <sea_dsp/sea_cascade_filter.h>
+#include <sea_dsp/sea_ladder_filter.h>
+#include <sea_dsp/sea_svf.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+namespace {
+
+constexpr double kFs = 48000.0;
+constexpr int kN = 256;
+
+// Uniform access to the four filters' per-sample API.
+struct Ladder {
+  using F = sea::LadderFilter<double>;
+  static void Init(F &f) { f.Init(kFs); }
+  static F::Coefficients Compute(const F &f, double fc, double res) {
+    return f.ComputeCoefficients(fc, res);
+  }
+  static void Set(F &f, const F::Coefficients &c) { f.SetCoefficients(c); }
+  static void SetParams(F &f, double fc, double res) {
+    f.SetParams(F::Model::Transistor, fc, res);
+  }
+  static double Tick(F &f, double x) { return f.Process(x); }
+};
+
+struct Svf {
+  using F = sea::SVFilter<double>;
+  static void Init(F &f) { f.Init(kFs); }
+  static F::Coefficients Compute(const F &f, double fc, double q) {
+    return f.ComputeCoefficients(fc, q);
+  }
+  static void Set(F &f, const F::Coefficients &c) { f.SetCoefficients(c); }
+  static void SetParams(F &f, double fc, double q) { f.SetParams(fc, q); }
+  static double Tick(F &f, double x) { return f.ProcessLP(x); }
+};
+
+struct Cascade {
+  using F = sea::CascadeFilter<double>;
+  static constexpr F::Slope kSlope = F::Slope::dB24;
+  static void Init(F &f) {
+    f.Init(kFs);
+    f.SetSlope(kSlope);
+  }
+  static F::Coefficients Compute(const F &f, double fc, double res) {
+    return f.ComputeCoefficients(fc, res);
+  }
+  static void Set(F &f, const F::Coefficients &c) {
+    f.SetCoefficients(c, kSlope);
+  }
+  static void SetParams(F &f, double fc, double res) {
+    f.SetParams(fc, res, kSlope);
+  }
+  static double Tick(F &f, double x) { return f.Process(x); }
+};
+
+struct Biquad {
+  using F = sea::BiquadFilter<double>;
+  static constexpr sea::FilterType kType = sea::FilterType::LowPass;
+  static void Init(F &f) {
+    f.Init(kFs);
+    f.SetParams(kType, 1000.0, 0.707);
+  }
+  static F::Coefficients Compute(const F &f, double fc, double q) {
+    return f.ComputeCoefficients(kType, fc, q);
+  }
+  static void Set(F &f, const F::Coefficients &c) { f.SetCoefficients(c); }
+  static void SetParams(F &f, double fc, double q) {
+    f.SetParams(kType, fc, q);
+  }
+  static double Tick(F &f, double x) { return f.Process(x); }
+};
+
+std::vector<double> Input() {
+  std::vector<double> in(kN);
+  for (int i = 0; i < kN; ++i)
+    in[static_cast<size_t>(i)] =
+        0.7 * std::sin(0.05 * i) + 0.2 * std::sin(0.31 * i);
+  return in;
+}
+
+template <typename A> void CheckBlockMatchesPerSample() {
+  using F = typename A::F;
+  const auto in = Input();
+  std::vector<double> ref(kN), blk(kN), split(kN);
+
+  // Ramp between coefficient sets: one call, and split over several calls.
+  F a, b, c;
+  for (F *f : {&a, &b, &c})
+    A::Init(*f);
+  const auto from = A::Compute(a, 300.0, 0.9);
+  const auto to = A::Compute(a, 4000.0, 0.9);
+  for (int i = 0; i < kN; ++i) {
+    A::Set(a, F::Coefficients::Lerp(from, to,
+                                    static_cast<double>(i + 1) * (1.0 / kN)));
+    ref[static_cast<size_t>(i)] = A::Tick(a, in[static_cast<size_t>(i)]);
+  }
+  b.ProcessBlock(in.data(), blk.data(), kN, from, to);
+  for (int pos = 0; pos < kN;) {
+    const int n = std::min(37, kN - pos);
+    c.ProcessBlock(in.data() + pos, split.data() + pos, n, from, to, pos, kN);
+    pos += n;
+  }
+  for (size_t i = 0; i < kN; ++i) {
+    REQUIRE(blk[i] == ref[i]);
+    REQUIRE(split[i] == ref[i]);
+  }
+
+  // Cutoff ramp lands on cutoffEnd and keeps it; constant cutoff skips the
+  // ramp and equals SetParams() + per-sample processing.
+  F d, e;
+  A::Init(d);
+  A::Init(e);
+  d.ProcessBlock(in.data(), blk.data(), kN, 300.0, 4000.0, 0.9);
+  e.ProcessBlock(in.data(), split.data(), kN, from, to);
+  for (size_t i = 0; i < kN; ++i)
+    REQUIRE(blk[i] == split[i]);
+  A::SetParams(a, 1200.0, 0.9);
+  d.ProcessBlock(in.data(), blk.data(), kN, 1200.0, 1200.0, 0.9);
+  for (size_t i = 0; i < kN; ++i)
+    REQUIRE(blk[i] == A::Tick(a, in[i]));
+}
+
+} // namespace
+
+TEST_CASE("Filter ProcessBlock matches per-sample coefficient updates",
+          "[Filter][Block]") {
+  CheckBlockMatchesPerSample<Ladder>();
+  CheckBlockMatchesPerSample<Svf>();
+  CheckBlockMatchesPerSample<Cascade>();
+  CheckBlockMatchesPerSample<Biquad>();
+}
+
+namespace {
+
+// A filter envelope sweeping the cutoff every sample, rendered per sample
+// with SetParams() or in 64-sample ProcessBlock() ramps.
+template <typename A> void TimeFilter(double &perSampleNs, double &blockNs) {
+  using F = typename A::F;
+  constexpr int kSamples = 48000 * 10;
+  constexpr int kBlock = 64;
+  std::vector<double> in(kSamples), out(kSamples);
+  for (int i = 0; i < kSamples; ++i)
+    in[static_cast<size_t>(i)] = static_cast<double>(i & 63) * 0.03 - 1.0;
+  auto cutoffAt = [](int i) {
+    return 200.0 + 10000.0 * static_cast<double>(i % 24000) / 24000.0;
+  };
+  auto time = [&](auto render) {
+    F f;
+    A::Init(f);
+    const auto t0 = std::chrono::high_resolution_clock::now();
+    render(f);
+    const auto t1 = std::chrono::high_resolution_clock::now();
+    return static_cast<double>(
+               std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0)
+                   .count()) /
+           kSamples;
+  };
+  perSampleNs = time([&](F &f) {
+    for (int i = 0; i < kSamples; ++i) {
+      A::SetParams(f, cutoffAt(i), 0.9);
+      out[static_cast<size_t>(i)] = A::Tick(f, in[static_cast<size_t>(i)]);
+    }
+  });
+  blockNs = time([&](F &f) {
+    for (int i = 0; i < kSamples; i += kBlock)
+      f.ProcessBlock(in.data() + i, out.data() + i, kBlock, cutoffAt(i),
+                     cutoffAt(i + kBlock - 1), 0.9);
+  });
+}
+
+} // namespace
+
+// Benchmark test (informational, not a failure condition)
+TEST_CASE("Filter ProcessBlock benchmark", "[Filter][Block][.benchmark]") {
+  double ns[4][2];
+  TimeFilter<Ladder>(ns[0][0], ns[0][1]);
+  TimeFilter<Svf>(ns[1][0], ns[1][1]);
+  TimeFilter<Cascade>(ns[2][0], ns[2][1]);
+  TimeFilter<Biquad>(ns[3][0], ns[3][1]);
+  WARN("swept cutoff, ns/sample per-sample SetParams -> 64-sample "
+       "ProcessBlock ramps: ladder "
+       << ns[0][0] << " -> " << ns[0][1] << ", SVF " << ns[1][0] << " -> "
+       << ns[1][1] << ", cascade " << ns[2][0] << " -> " << ns[2][1]
+       << ", biquad " << ns[3][0] << " -> " << ns[3][1]);
+  SUCCEED();
+}
@@ -37,3 +37,23 @@ TEST_CASE("LadderFilter Type Safety - Float vs Double", "[Filter][LadderFilter][
 
   REQUIRE(std::abs(static_cast<double>(lastF) - lastD) < 0.01);
 }
+
+TEST_CASE("LadderFilter SetCoefficients matches SetParams", "[Filter][LadderFilter]") {
+  using LF = sea::LadderFilter<double>;
+  LF direct, viaCoeffs;
+  direct.Init(48000.0);
+  viaCoeffs.Init(48000.0);
+  direct.SetParams(LF::Model::Transistor, 1800.0, 0.7);
+  viaCoeffs.SetCoefficients(viaCoeffs.ComputeCoefficients(1800.0, 0.7));
+
+  for (int i = 0; i < 256; ++i) {
+    double in = std::sin(0.05 * i);
+    REQUIRE(viaCoeffs.Process(in) == direct.Process(in));
+  }
+
+  // Lerp endpoints reproduce the inputs exactly.
+  auto a = direct.ComputeCoefficients(200.0, 0.2);
+  auto b = direct.ComputeCoefficients(5000.0, 0.9);
+  REQUIRE(LF::Coefficients::Lerp(a, b, 0.0).g == a.g);
+  REQUIRE(LF::Coefficients::Lerp(a, b, 1.0).g == b.g);
+}
@@ -0,0 +1,173 @@
+#include "catch.hpp"
+#include <sea_dsp/sea_ladder_filter_lanes.h>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+namespace {
+
+template <typename T, int Lanes> void CheckLanesMatchScalar() {
+  using Scalar = sea::LadderFilter<T>;
+  const T sampleRate = static_cast<T>(48000.0);
+  Scalar scalar[Lanes];
+  for (int l = 0; l < Lanes; ++l) {
+    scalar[l].Init(sampleRate);
+    scalar[l].SetParams(Scalar::Model::Transistor,
+                        static_cast<T>(200.0 + 700.0 * l),
+                        static_cast<T>(0.15 * (l % 7)));
+  }
+  sea::LadderFilterLanes<T, Lanes> lanes;
+  for (int l = 0; l < Lanes; ++l)
+    lanes.Load(l, scalar[l]);
+
+  T in[Lanes];
+  T out[Lanes];
+  for (int i = 0; i < 2000; ++i) {
+    if (i % 97 == 0) {
+      // Sweep every lane's cutoff, as a filter envelope would.
+      for (int l = 0; l < Lanes; ++l) {
+        scalar[l].SetParams(Scalar::Model::Transistor,
+                            static_cast<T>(300.0 + 11.0 * i + 500.0 * l),
+                            static_cast<T>(0.1 * (l % 5) + 0.3));
+        lanes.SetCoefficients(l, scalar[l].GetCoefficients());
+      }
+    }
+    for (int l = 0; l < Lanes; ++l)
+      in[l] = static_cast<T>(std::sin(0.01 * (l + 1) * i) * 0.8);
+    lanes.Process(in, out);
+    for (int l = 0; l < Lanes; ++l)
+      REQUIRE(out[l] == scalar[l].Process(in[l]));
+  }
+
+  // Store() hands back the exact scalar state.
+  Scalar restored[Lanes];
+  for (int l = 0; l < Lanes; ++l) {
+    restored[l] = scalar[l];
+    restored[l].Reset();
+    lanes.Store(l, restored[l]);
+    for (int st = 0; st < 4; ++st)
+      REQUIRE(restored[l].GetState(st) == scalar[l].GetState(st));
+  }
+}
+
+} // namespace
+
+TEST_CASE("LadderFilterLanes matches LadderFilter in every lane",
+          "[Filter][LadderFilter][Lanes]") {
+  CheckLanesMatchScalar<float, 4>();
+  CheckLanesMatchScalar<float, 8>();
+  CheckLanesMatchScalar<double, 2>();
+  CheckLanesMatchScalar<double, 4>();
+}
+
+TEST_CASE("LadderFilterLanes inactive lanes hold their state",
+          "[Filter][LadderFilter][Lanes]") {
+  sea::LadderFilter<float> scalar;
+  scalar.Init(48000.0f);
+  scalar.SetParams(sea::LadderFilter<float>::Model::Transistor, 900.0f, 0.6f);
+  sea::LadderFilter4<float> lanes;
+  lanes.Load(2, scalar);
+
+  float in[4] = {0.5f, 0.5f, 0.5f, 0.5f};
+  float out[4];
+  for (int i = 0; i < 64; ++i) {
+    lanes.Process(in, out);
+    scalar.Process(in[2]);
+  }
+  // Lanes 0, 1, 3 were never loaded: inactive, silent.
+  CHECK(out[0] == 0.0f);
+  CHECK(out[1] == 0.0f);
+  CHECK(out[3] == 0.0f);
+
+  lanes.SetActive(2, false);
+  for (int i = 0; i < 64; ++i) {
+    lanes.Process(in, out);
+    CHECK(out[2] == 0.0f);
+  }
+  sea::LadderFilter<float> stored = scalar;
+  stored.Reset();
+  lanes.Store(2, stored);
+  for (int st = 0; st < 4; ++st)
+    CHECK(stored.GetState(st) == scalar.GetState(st));
+}
+
+namespace {
+
+// 16 voices' ladders, each with its own cutoff moving every sample (as under
+// a filter envelope), rendered for one second. Returns ns per voice-sample.
+template <int Lanes> double LadderNsPerVoiceSample() {
+  using Real = sea::Real;
+  using Scalar = sea::LadderFilter<Real>;
+  constexpr int kVoices = 16;
+  constexpr int kSamples = 48000;
+  Scalar scalar[kVoices];
+  std::vector<typename Scalar::Coefficients> coeffs(256);
+  for (int v = 0; v < kVoices; ++v)
+    scalar[v].Init(static_cast<Real>(48000.0));
+  for (size_t c = 0; c < coeffs.size(); ++c)
+    coeffs[c] = scalar[0].ComputeCoefficients(
+        static_cast<Real>(100.0 + 40.0 * static_cast<double>(c)),
+        static_cast<Real>(0.5));
+
+  volatile Real sink = 0;
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  if constexpr (Lanes == 1) {
+    for (int i = 0; i < kSamples; ++i) {
+      Real acc = 0;
+      for (int v = 0; v < kVoices; ++v) {
+        scalar[v].SetCoefficients(coeffs[static_cast<size_t>((i + 13 * v) & 255)]);
+        acc += scalar[v].Process(static_cast<Real>((i + v) & 63) *
+                                 static_cast<Real>(0.02));
+      }
+      sink = sink + acc;
+    }
+  } else {
+    constexpr int kGroups = kVoices / Lanes;
+    sea::LadderFilterLanes<Real, Lanes> groups[kGroups];
+    for (int g = 0; g < kGroups; ++g)
+      for (int l = 0; l < Lanes; ++l)
+        groups[g].Load(l, scalar[g * Lanes + l]);
+    alignas(sea::simd::kAlignment) Real in[Lanes];
+    alignas(sea::simd::kAlignment) Real out[Lanes];
+    for (int i = 0; i < kSamples; ++i) {
+      Real acc = 0;
+      for (int g = 0; g < kGroups; ++g) {
+        for (int l = 0; l < Lanes; ++l) {
+          const int v = g * Lanes + l;
+          groups[g].SetCoefficients(
+              l, coeffs[static_cast<size_t>((i + 13 * v) & 255)]);
+          in[l] = static_cast<Real>((i + v) & 63) * static_cast<Real>(0.02);
+        }
+        groups[g].Process(in, out);
+        for (int l = 0; l < Lanes; ++l)
+          acc += out[l];
+      }
+      sink = sink + acc;
+    }
+  }
+  const auto t1 = std::chrono::high_resolution_clock::now();
+  (void)sink;
+  return static_cast<double>(
+             std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0)
+                 .count()) /
+         (kVoices * kSamples);
+}
+
+} // namespace
+
+// Benchmark test (informational, not a failure condition)
+TEST_CASE("LadderFilterLanes voices-per-core benchmark",
+          "[Filter][LadderFilter][Lanes][.benchmark]") {
+  // A core renders 1e9 / 48000 ns of audio per second of wall time; the
+  // ladder alone would fit that many ns / (ns per voice-sample) voices.
+  constexpr double kNsPerSample = 1e9 / 48000.0;
+  const double scalar = LadderNsPerVoiceSample<1>();
+  const double four = LadderNsPerVoiceSample<4>();
+  const double eight = LadderNsPerVoiceSample<8>();
+  WARN("ladder ns per voice-sample (voices per core): scalar "
+       << scalar << " (" << kNsPerSample / scalar << "), 4 lanes " << four
+       << " (" << kNsPerSample / four << "), 8 lanes " << eight << " ("
+       << kNsPerSample / eight << "), SIMD lanes for Real: "
+       << sea::simd::kLanes<sea::Real>);
+  SUCCEED();
+}
@@ -0,0 +1,57 @@
+#include "catch.hpp"
+#include "sea_dsp/sea_linear_ramp.h"
+
+TEST_CASE("LinearRamp Self-Contained Header", "[LinearRamp][SelfContained]") {
+  sea::LinearRamp<float> ramp;
+  REQUIRE(ramp.Current() == 0.0f);
+  REQUIRE_FALSE(ramp.IsRamping());
+}
+
+TEST_CASE("LinearRamp reaches the target in exactly numSteps", "[LinearRamp]") {
+  sea::LinearRamp<double> ramp;
+  ramp.Reset(1.0);
+  ramp.SetTarget(0.0, 4);
+  REQUIRE(ramp.IsRamping());
+  CHECK(ramp.Next() == Approx(0.75));
+  CHECK(ramp.Next() == Approx(0.5));
+  CHECK(ramp.Next() == Approx(0.25));
+  CHECK(ramp.Next() == 0.0);
+  CHECK_FALSE(ramp.IsRamping());
+  CHECK(ramp.Next() == 0.0);
+}
+
+TEST_CASE("LinearRamp steps are constant and land on the target",
+          "[LinearRamp]") {
+  sea::LinearRamp<float> ramp;
+  ramp.Reset(200.0f);
+  ramp.SetTarget(8000.0f, 960);
+  float prev = ramp.Current();
+  for (int i = 0; i < 960; ++i) {
+    const float v = ramp.Next();
+    CHECK((v - prev) == Approx(7800.0f / 960.0f).margin(0.01f));
+    prev = v;
+  }
+  CHECK(prev == 8000.0f);
+}
+
+TEST_CASE("LinearRamp retarget starts from the current value", "[LinearRamp]") {
+  sea::LinearRamp<double> ramp;
+  ramp.Reset(0.0);
+  ramp.SetTarget(1.0, 10);
+  for (int i = 0; i < 5; ++i)
+    ramp.Next();
+  ramp.SetTarget(0.0, 5);
+  CHECK(ramp.Next() == Approx(0.4));
+  CHECK(ramp.GetRemainingSteps() == 4);
+}
+
+TEST_CASE("LinearRamp snaps with zero steps or an unchanged target",
+          "[LinearRamp]") {
+  sea::LinearRamp<double> ramp;
+  ramp.Reset(0.5);
+  ramp.SetTarget(0.9, 0);
+  CHECK(ramp.Current() == 0.9);
+  CHECK_FALSE(ramp.IsRamping());
+  ramp.SetTarget(0.9, 100);
+  CHECK_FALSE(ramp.IsRamping());
+}
@@ -76,3 +76,38 @@ TEST_CASE("Oscillator pulse width is clamped for square waveform", "[Oscillator]
   // If PW were not clamped above 0, we'd get almost always -1.
   REQUIRE(positiveCount > 0);
 }
+
+TEST_CASE("Oscillator Advance matches per-sample Process", "[Oscillator]") {
+  SECTION("fixed-point phase is bit-exact") {
+    sea::BasicOscillator<double, uint32_t> stepped;
+    sea::BasicOscillator<double, uint32_t> skipped;
+    for (auto *osc : {&stepped, &skipped}) {
+      osc->Init(48000.0);
+      osc->SetWaveform(sea::OscillatorWaveform::Saw);
+      osc->SetFrequency(261.63);
+    }
+    for (int i = 0; i < 48011; ++i)
+      stepped.Process();
+    skipped.Advance(48011);
+    REQUIRE(skipped.GetPhase() == stepped.GetPhase());
+    REQUIRE(skipped.Process() == stepped.Process());
+  }
+
+  SECTION("floating-point phase matches to rounding") {
+    sea::Oscillator stepped;
+    sea::Oscillator skipped;
+    for (auto *osc : {&stepped, &skipped}) {
+      osc->Init(48000.0);
+      osc->SetWaveform(sea::OscillatorWaveform::Saw);
+      osc->SetFrequency(261.63);
+    }
+    for (int i = 0; i < 48011; ++i)
+      stepped.Process();
+    skipped.Advance(48011);
+    REQUIRE(skipped.GetPhase() == Approx(stepped.GetPhase()).margin(1e-9));
+
+    skipped.Advance(1ull << 40);
+    REQUIRE(skipped.GetPhase() >= 0.0);
+    REQUIRE(skipped.GetPhase() < 1.0);
+  }
+}
@@ -0,0 +1,130 @@
+#include "catch.hpp"
+#include <sea_dsp/sea_oscillator.h>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+namespace {
+
+using Osc = sea::BasicOscillator<double>;
+using Waveform = sea::OscillatorWaveform;
+using Antialias = sea::OscillatorAntialias;
+
+constexpr double kSampleRate = 48000.0;
+
+void Configure(Osc &osc, Waveform w, Antialias mode) {
+  osc.Init(kSampleRate);
+  osc.SetWaveform(w);
+  osc.SetAntialias(mode);
+  osc.SetFrequency(1234.5);
+  osc.SetPulseWidth(0.3);
+}
+
+} // namespace
+
+TEST_CASE("Oscillator ProcessBlock matches Process", "[Oscillator][Block]") {
+  constexpr int kFrames = 1000; // spans several internal chunks
+  std::vector<double> freq(kFrames);
+  std::vector<double> pw(kFrames);
+  for (int i = 0; i < kFrames; ++i) {
+    freq[static_cast<size_t>(i)] = 300.0 + 2500.0 * std::sin(0.01 * i) + 2600.0;
+    pw[static_cast<size_t>(i)] = 0.5 + 0.6 * std::sin(0.003 * i); // clamps
+  }
+
+  for (Waveform w : {Waveform::Saw, Waveform::Square, Waveform::Triangle,
+                     Waveform::Sine}) {
+    for (Antialias mode : {Antialias::Naive, Antialias::PolyBLEP}) {
+      for (int variant = 0; variant < 4; ++variant) {
+        const bool modFreq = (variant & 1) != 0;
+        const bool modPw = (variant & 2) != 0;
+        Osc ref;
+        Osc blk;
+        Configure(ref, w, mode);
+        Configure(blk, w, mode);
+
+        std::vector<double> block(kFrames);
+        // Uneven block lengths exercise chunk boundaries.
+        for (int done = 0, b = 0; done < kFrames; ++b) {
+          const int n = std::min(kFrames - done, 1 + (b * 53) % 150);
+          blk.ProcessBlock(block.data() + done, n,
+                           modFreq ? freq.data() + done : nullptr,
+                           modPw ? pw.data() + done : nullptr);
+          done += n;
+        }
+        for (int i = 0; i < kFrames; ++i) {
+          if (modFreq)
+            ref.SetFrequency(freq[static_cast<size_t>(i)]);
+          if (modPw)
+            ref.SetPulseWidth(pw[static_cast<size_t>(i)]);
+          const double expected = ref.Process();
+          INFO("waveform " << static_cast<int>(w) << " mode "
+                           << static_cast<int>(mode) << " variant " << variant
+                           << " sample " << i);
+          REQUIRE(block[static_cast<size_t>(i)] == expected);
+        }
+        // Both leave the oscillator in the same state.
+        REQUIRE(blk.GetPhaseIncrement() == ref.GetPhaseIncrement());
+        REQUIRE(blk.Process() == ref.Process());
+      }
+    }
+  }
+}
+
+// Benchmark test (informational, not a failure condition)
+TEST_CASE("Oscillator block vs per-sample benchmark",
+          "[Oscillator][.benchmark]") {
+  using Real = sea::Real;
+  constexpr int kBlock = 64;
+  constexpr int kBlocks = 48000 * 20 / kBlock;
+  std::vector<Real> freq(kBlock);
+  for (int i = 0; i < kBlock; ++i)
+    freq[static_cast<size_t>(i)] = static_cast<Real>(440.0 + i);
+  Real out[kBlock];
+
+  auto nsPerSample = [](auto t0, auto t1) {
+    return static_cast<double>(
+               std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0)
+                   .count()) /
+           (static_cast<double>(kBlocks) * kBlock);
+  };
+
+  for (Waveform w : {Waveform::Saw, Waveform::Square, Waveform::Triangle}) {
+    sea::Oscillator osc;
+    osc.Init(static_cast<Real>(kSampleRate));
+    osc.SetWaveform(w);
+    osc.SetFrequency(static_cast<Real>(440.0));
+    volatile Real sink = 0;
+
+    auto t0 = std::chrono::high_resolution_clock::now();
+    for (int b = 0; b < kBlocks; ++b) {
+      for (int i = 0; i < kBlock; ++i)
+        out[i] = osc.Process();
+      sink = sink + out[0];
+    }
+    auto t1 = std::chrono::high_resolution_clock::now();
+    for (int b = 0; b < kBlocks; ++b) {
+      osc.ProcessBlock(out, kBlock);
+      sink = sink + out[0];
+    }
+    auto t2 = std::chrono::high_resolution_clock::now();
+    for (int b = 0; b < kBlocks; ++b) {
+      for (int i = 0; i < kBlock; ++i) {
+        osc.SetFrequency(freq[static_cast<size_t>(i)]);
+        out[i] = osc.Process();
+      }
+      sink = sink + out[0];
+    }
+    auto t3 = std::chrono::high_resolution_clock::now();
+    for (int b = 0; b < kBlocks; ++b) {
+      osc.ProcessBlock(out, kBlock, freq.data());
+      sink = sink + out[0];
+    }
+    auto t4 = std::chrono::high_resolution_clock::now();
+    (void)sink;
+    WARN("waveform " << static_cast<int>(w) << ": fixed " << nsPerSample(t0, t1)
+                     << " -> " << nsPerSample(t1, t2) << " ns/sample, FM "
+                     << nsPerSample(t2, t3) << " -> " << nsPerSample(t3, t4)
+                     << " ns/sample (Process -> ProcessBlock)");
+  }
+  SUCCEED();
+}
@@ -0,0 +1,139 @@
+#include "SpectrumTestUtils.h"
+#include "catch.hpp"
+#include <sea_dsp/sea_oversampler.h>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+namespace {
+
+constexpr double kPiD = 3.14159265358979323846;
+
+// Largest |round trip - input delayed by GetLatency()| for a sine at
+// `freq` (in units of the base sample rate), after the filters settle.
+double RoundTripError(int factor, double freq, int blockSize) {
+  sea::Oversampler<double> os;
+  os.SetFactor(factor);
+  const double latency = os.GetLatency();
+  constexpr int kN = 4096;
+  std::vector<double> in(kN), up(kN * 4), out(kN);
+  for (int i = 0; i < kN; ++i)
+    in[static_cast<size_t>(i)] = std::sin(2.0 * kPiD * freq * i);
+  for (int i = 0; i < kN; i += blockSize) {
+    os.Upsample(in.data() + i, up.data(), blockSize);
+    os.Downsample(up.data(), out.data() + i, blockSize);
+  }
+  double maxErr = 0.0;
+  for (int i = 256; i < kN; ++i) {
+    const double expected = std::sin(2.0 * kPiD * freq * (i - latency));
+    maxErr = std::max(maxErr, std::abs(out[static_cast<size_t>(i)] - expected));
+  }
+  return maxErr;
+}
+
+} // namespace
+
+TEST_CASE("Oversampler factor and latency", "[Oversampler]") {
+  sea::Oversampler<float> os;
+  REQUIRE(os.GetFactor() == 1);
+  REQUIRE(os.GetLatency() == 0.0f);
+  os.SetFactor(3);
+  REQUIRE(os.GetFactor() == 2);
+  REQUIRE(os.GetLatency() == 15.0f);
+  os.SetFactor(8);
+  REQUIRE(os.GetFactor() == 4);
+  REQUIRE(os.GetLatency() == 18.5f);
+
+  // 1x is a plain copy.
+  os.SetFactor(1);
+  const float in[3] = {0.25f, -1.0f, 0.5f};
+  float up[3], out[3];
+  os.Upsample(in, up, 3);
+  os.Downsample(up, out, 3);
+  for (int i = 0; i < 3; ++i)
+    REQUIRE(out[i] == in[i]);
+}
+
+TEST_CASE("Oversampler round trip is the input delayed by its latency",
+          "[Oversampler]") {
+  // 1 kHz and 15 kHz at 48 kHz, whole blocks and one sample at a time.
+  for (int factor : {2, 4}) {
+    CHECK(RoundTripError(factor, 1000.0 / 48000.0, 64) < 1e-3);
+    CHECK(RoundTripError(factor, 15000.0 / 48000.0, 64) < 0.02);
+    CHECK(RoundTripError(factor, 1000.0 / 48000.0, 1) < 1e-3);
+  }
+}
+
+TEST_CASE("Oversampler rejects upsampling images", "[Oversampler]") {
+  // A bin-aligned sine at ~0.2 fs, upsampled: everything except the
+  // fundamental is an image (or filter leakage).
+  constexpr size_t kN = 4096;
+  constexpr size_t kBin = 811;
+  for (int factor : {2, 4}) {
+    sea::Oversampler<double> os;
+    os.SetFactor(factor);
+    std::vector<double> in(kN * 2), up(kN * 2 * factor);
+    for (size_t i = 0; i < in.size(); ++i)
+      in[i] = std::sin(2.0 * kPiD * static_cast<double>(kBin * factor) *
+                       static_cast<double>(i) /
+                       static_cast<double>(kN * factor));
+    os.Upsample(in.data(), up.data(), static_cast<int>(in.size()));
+    // Skip the warm-up: analyse the last kN * factor samples.
+    std::vector<double> tail(up.end() - static_cast<long>(kN * factor),
+                             up.end());
+    const double imageDb =
+        sea_test::AliasingDb(tail, kBin);
+    INFO("factor " << factor << ": image " << imageDb << " dB");
+    CHECK(imageDb < -60.0);
+  }
+}
+
+namespace {
+
+// tanh drive of a bin-aligned 5 kHz-ish sine: the odd harmonics fold back
+// at 1x. Returns aliasing below 20 kHz (dB below the harmonics there; the
+// half-band decimators let the 20-24 kHz band alias by design) and ns per
+// base-rate sample.
+void MeasureTanh(int factor, double &aliasDb, double &ns) {
+  constexpr size_t kN = 8192;
+  constexpr size_t kBin = 853; // ~5 kHz at 48 kHz, prime
+  constexpr int kRepeats = 50;
+  sea::Oversampler<double> os;
+  os.SetFactor(factor);
+  std::vector<double> in(kN), out(kN), up(kN * 4);
+  for (size_t i = 0; i < kN; ++i)
+    in[i] = std::sin(2.0 * kPiD * static_cast<double>(kBin * i) /
+                     static_cast<double>(kN));
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  for (int r = 0; r < kRepeats; ++r) {
+    for (size_t i = 0; i < kN; i += 64) {
+      os.Upsample(in.data() + i, up.data(), 64);
+      for (int k = 0; k < 64 * factor; ++k)
+        up[static_cast<size_t>(k)] = std::tanh(4.0 * up[static_cast<size_t>(k)]);
+      os.Downsample(up.data(), out.data() + i, 64);
+    }
+  }
+  const auto t1 = std::chrono::high_resolution_clock::now();
+  ns = static_cast<double>(
+           std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0)
+               .count()) /
+       static_cast<double>(kN * kRepeats);
+  aliasDb = sea_test::AliasingDb(out, kBin, kN * 20 / 48);
+}
+
+} // namespace
+
+// Benchmark test (informational, not a failure condition)
+TEST_CASE("Oversampler CPU vs alias rejection benchmark",
+          "[Oversampler][.benchmark]") {
+  double alias[3], ns[3];
+  MeasureTanh(1, alias[0], ns[0]);
+  MeasureTanh(2, alias[1], ns[1]);
+  MeasureTanh(4, alias[2], ns[2]);
+  WARN("tanh(4 sin) at ~5 kHz / 48 kHz, aliasing below 20 kHz in dB / ns "
+       "per sample: 1x "
+       << alias[0] << " / " << ns[0] << ", 2x " << alias[1] << " / " << ns[1]
+       << ", 4x " << alias[2] << " / " << ns[2]);
+  CHECK(alias[1] < alias[0]);
+  CHECK(alias[2] < alias[1]);
+}
@@ -0,0 +1,126 @@
+#include "SpectrumTestUtils.h"
+#include "catch.hpp"
+#include <sea_dsp/sea_oscillator.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+namespace {
+
+using Osc = sea::BasicOscillator<double>;
+using Waveform = sea::OscillatorWaveform;
+using Antialias = sea::OscillatorAntialias;
+
+constexpr double kSampleRate = 48000.0;
+constexpr size_t kFftSize = 8192;
+
+double AliasingDb(Waveform waveform, Antialias mode, size_t bin) {
+  Osc osc;
+  osc.Init(kSampleRate);
+  osc.SetWaveform(waveform);
+  osc.SetAntialias(mode);
+  osc.SetPulseWidth(0.3);
+  osc.SetFrequency(kSampleRate * double(bin) / double(kFftSize));
+  for (int i = 0; i < 1000; ++i)
+    osc.Process();
+
+  std::vector<double> signal(kFftSize);
+  for (auto &s : signal)
+    s = osc.Process();
+  return sea_test::AliasingDb(signal, bin);
+}
+
+} // namespace
+
+TEST_CASE("PolyBLEP oscillator keeps the naive waveform shape",
+          "[Oscillator][PolyBLEP]") {
+  // At a low note the corrections only touch the sample either side of an
+  // edge, so the band-limited output tracks the naive one elsewhere.
+  for (Waveform w : {Waveform::Saw, Waveform::Square, Waveform::Triangle}) {
+    Osc naive;
+    Osc blep;
+    naive.Init(kSampleRate);
+    blep.Init(kSampleRate);
+    naive.SetWaveform(w);
+    blep.SetWaveform(w);
+    blep.SetAntialias(Antialias::PolyBLEP);
+    naive.SetFrequency(110.0);
+    blep.SetFrequency(110.0);
+
+    int differing = 0;
+    double peak = 0.0;
+    for (int i = 0; i < 4800; ++i) {
+      const double a = naive.Process();
+      const double b = blep.Process();
+      peak = std::max(peak, std::abs(b));
+      if (std::abs(a - b) > 1e-9)
+        ++differing;
+    }
+    INFO("waveform " << static_cast<int>(w));
+    CHECK(peak <= 1.0 + 1e-9);
+    // Two corrected samples per edge, 110 cycles, up to two edges/cycle.
+    CHECK(differing <= 4 * 11 + 4);
+  }
+}
+
+TEST_CASE("PolyBLEP oscillator reduces aliasing at high notes",
+          "[Oscillator][PolyBLEP]") {
+  // Bin 427 of 8192 at 48 kHz is ~2.5 kHz: harmonics fold from the 10th on.
+  constexpr size_t kBin = 427;
+  struct Case {
+    Waveform waveform;
+    double minImprovementDb;
+  };
+  for (const Case c : {Case{Waveform::Saw, 12.0}, Case{Waveform::Square, 12.0},
+                       Case{Waveform::Triangle, 12.0}}) {
+    const double naive = AliasingDb(c.waveform, Antialias::Naive, kBin);
+    const double blep = AliasingDb(c.waveform, Antialias::PolyBLEP, kBin);
+    INFO("waveform " << static_cast<int>(c.waveform) << ": naive " << naive
+                     << " dB, PolyBLEP " << blep << " dB");
+    CHECK(blep < naive - c.minImprovementDb);
+  }
+}
+
+TEST_CASE("PolyBLEP mode leaves sine untouched", "[Oscillator][PolyBLEP]") {
+  Osc naive;
+  Osc blep;
+  naive.Init(kSampleRate);
+  blep.Init(kSampleRate);
+  naive.SetWaveform(Waveform::Sine);
+  blep.SetWaveform(Waveform::Sine);
+  blep.SetAntialias(Antialias::PolyBLEP);
+  naive.SetFrequency(3000.0);
+  blep.SetFrequency(3000.0);
+  for (int i = 0; i < 1000; ++i)
+    REQUIRE(naive.Process() == blep.Process());
+}
+
+// Benchmark test (informational, not a failure condition)
+TEST_CASE("PolyBLEP vs naive oscillator benchmark",
+          "[Oscillator][.benchmark]") {
+  constexpr int kSamples = 48000 * 20;
+  for (Waveform w : {Waveform::Saw, Waveform::Square, Waveform::Triangle}) {
+    double ns[2] = {0.0, 0.0};
+    for (int m = 0; m < 2; ++m) {
+      sea::Oscillator osc;
+      osc.Init(static_cast<sea::Real>(kSampleRate));
+      osc.SetWaveform(w);
+      osc.SetAntialias(m == 0 ? Antialias::Naive : Antialias::PolyBLEP);
+      osc.SetFrequency(static_cast<sea::Real>(1234.5));
+      volatile sea::Real sink = 0;
+      const auto t0 = std::chrono::high_resolution_clock::now();
+      for (int i = 0; i < kSamples; ++i)
+        sink = sink + osc.Process();
+      const auto t1 = std::chrono::high_resolution_clock::now();
+      (void)sink;
+      ns[m] = static_cast<double>(
+                  std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0)
+                      .count()) /
+              kSamples;
+    }
+    WARN("waveform " << static_cast<int>(w) << ": naive " << ns[0]
+                     << " ns/sample, PolyBLEP " << ns[1] << " ns/sample");
+  }
+  SUCCEED();
+}
@@ -0,0 +1,186 @@
+#include "SpectrumTestUtils.h"
+#include "catch.hpp"
+#include <sea_dsp/sea_wavetable_oscillator.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+namespace {
+
+using WtOsc = sea::BasicWavetableOscillator<double>;
+using Tables = sea::MipMappedWavetables;
+using Waveform = sea::OscillatorWaveform;
+
+constexpr double kSampleRate = 48000.0;
+constexpr size_t kFftSize = 8192;
+
+template <typename Osc>
+std::vector<double> Render(Osc &osc, size_t bin, size_t frames) {
+  osc.SetFrequency(kSampleRate * double(bin) / double(kFftSize));
+  for (int i = 0; i < 1000; ++i)
+    osc.Process();
+  std::vector<double> out(frames);
+  for (auto &s : out)
+    s = osc.Process();
+  return out;
+}
+
+} // namespace
+
+TEST_CASE("Wavetables are built once and shared", "[WavetableOscillator]") {
+  WtOsc a;
+  WtOsc b;
+  a.Init(kSampleRate);
+  b.Init(44100.0);
+  REQUIRE(&Tables::Get() == &Tables::Get());
+  REQUIRE(Tables::Get().Table(Tables::kSaw, 3) ==
+          Tables::Get().Table(Tables::kSaw, 3));
+}
+
+TEST_CASE("Mip level keeps every harmonic below Nyquist",
+          "[WavetableOscillator]") {
+  REQUIRE(Tables::LevelFor(0.0) == 0);
+  REQUIRE(Tables::LevelFor(1e-5) == 0);
+  REQUIRE(Tables::LevelFor(0.25) == 9);  // 2 harmonics
+  REQUIRE(Tables::LevelFor(0.49) == 10); // fundamental only
+  for (double inc = 1e-4; inc < 0.5; inc *= 1.07) {
+    const int level = Tables::LevelFor(inc);
+    const double harmonics = double(Tables::kMaxHarmonics >> level);
+    INFO("increment " << inc << " level " << level);
+    CHECK(harmonics * inc <= 0.5);
+    if (level > 0)
+      CHECK(2.0 * harmonics * inc > 0.5); // the fuller level would alias
+  }
+}
+
+TEST_CASE("Wavetable oscillator is alias-free at high notes",
+          "[WavetableOscillator]") {
+  constexpr size_t kBin = 427; // ~2.5 kHz
+  for (Waveform w : {Waveform::Saw, Waveform::Square, Waveform::Triangle}) {
+    WtOsc osc;
+    osc.Init(kSampleRate);
+    osc.SetWaveform(w);
+    osc.SetPulseWidth(0.3);
+    const double db = sea_test::AliasingDb(Render(osc, kBin, kFftSize), kBin);
+    INFO("waveform " << static_cast<int>(w) << ": " << db << " dB");
+    CHECK(db < -70.0);
+  }
+}
+
+TEST_CASE("Wavetable pulse width sets the duty cycle",
+          "[WavetableOscillator]") {
+  for (double pw : {0.1, 0.3, 0.5, 0.8}) {
+    WtOsc osc;
+    osc.Init(kSampleRate);
+    osc.SetWaveform(Waveform::Square);
+    osc.SetPulseWidth(pw);
+    // 480 samples = exactly 1 cycle at 100 Hz.
+    osc.SetFrequency(100.0);
+    double sum = 0.0;
+    double peak = 0.0;
+    for (int i = 0; i < 480; ++i) {
+      const double s = osc.Process();
+      sum += s;
+      peak = std::max(peak, std::abs(s));
+    }
+    INFO("pw " << pw);
+    CHECK(sum / 480.0 == Approx(2.0 * pw - 1.0).margin(0.01));
+    CHECK(peak < 1.2);
+  }
+}
+
+TEST_CASE("Wavetable sine matches the oscillator sine",
+          "[WavetableOscillator]") {
+  WtOsc wt;
+  sea::BasicOscillator<double> ref;
+  wt.Init(kSampleRate);
+  ref.Init(kSampleRate);
+  wt.SetWaveform(Waveform::Sine);
+  ref.SetWaveform(Waveform::Sine);
+  wt.SetFrequency(440.0);
+  ref.SetFrequency(440.0);
+  for (int i = 0; i < 2000; ++i)
+    REQUIRE(wt.Process() == Approx(ref.Process()).margin(1e-5));
+}
+
+TEST_CASE("Wavetable oscillator is silent before Init",
+          "[WavetableOscillator]") {
+  WtOsc wt;
+  wt.SetFrequency(440.0);
+  for (int i = 0; i < 16; ++i)
+    REQUIRE(wt.Process() == 0.0);
+}
+
+TEST_CASE("Wavetable negative frequency runs the cycle backwards",
+          "[WavetableOscillator]") {
+  WtOsc forward, backward;
+  forward.Init(kSampleRate);
+  backward.Init(kSampleRate);
+  forward.SetWaveform(Waveform::Sine);
+  backward.SetWaveform(Waveform::Sine);
+  forward.SetFrequency(440.0);
+  backward.SetFrequency(-440.0);
+  for (int i = 0; i < 2000; ++i)
+    REQUIRE(backward.Process() == Approx(-forward.Process()).margin(1e-5));
+}
+
+TEST_CASE("Float-phase wavetable pulse stays bounded in both directions",
+          "[WavetableOscillator]") {
+  sea::BasicWavetableOscillator<float> osc;
+  osc.Init(static_cast<float>(kSampleRate));
+  osc.SetWaveform(Waveform::Square);
+  for (float pw : {0.1f, 0.3f, 0.5f, 0.77f}) {
+    osc.SetPulseWidth(pw);
+    for (float freq : {97.0f, 1234.5f, -97.0f, -1234.5f}) {
+      osc.SetFrequency(freq);
+      for (int i = 0; i < 48000; ++i)
+        REQUIRE(std::abs(osc.Process()) < 1.5f);
+    }
+  }
+}
+
+// Benchmark test (informational, not a failure condition)
+TEST_CASE("Wavetable vs PolyBLEP oscillator under audio-rate FM",
+          "[WavetableOscillator][.benchmark]") {
+  constexpr int kSamples = 48000 * 20;
+  using Real = sea::Real;
+  sea::Oscillator modulator;
+  modulator.Init(static_cast<Real>(kSampleRate));
+  modulator.SetWaveform(Waveform::Sine);
+  modulator.SetFrequency(static_cast<Real>(310.0));
+  std::vector<Real> fm(kSamples);
+  for (auto &f : fm)
+    f = static_cast<Real>(880.0) *
+        (static_cast<Real>(1.0) + static_cast<Real>(0.5) * modulator.Process());
+
+  auto time = [&](auto &osc, Waveform w) {
+    osc.Init(static_cast<Real>(kSampleRate));
+    osc.SetWaveform(w);
+    osc.SetPulseWidth(static_cast<Real>(0.3));
+    volatile Real sink = 0;
+    const auto t0 = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < kSamples; ++i) {
+      osc.SetFrequency(fm[static_cast<size_t>(i)]);
+      sink = sink + osc.Process();
+    }
+    const auto t1 = std::chrono::high_resolution_clock::now();
+    (void)sink;
+    return static_cast<double>(
+               std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0)
+                   .count()) /
+           kSamples;
+  };
+
+  for (Waveform w : {Waveform::Saw, Waveform::Square, Waveform::Triangle}) {
+    sea::Oscillator blep;
+    blep.SetAntialias(sea::OscillatorAntialias::PolyBLEP);
+    sea::WavetableOscillator table;
+    const double blepNs = time(blep, w);
+    const double tableNs = time(table, w);
+    WARN("FM waveform " << static_cast<int>(w) << ": PolyBLEP " << blepNs
+                        << " ns/sample, wavetable " << tableNs
+                        << " ns/sample");
+  }
+  SUCCEED();
+}
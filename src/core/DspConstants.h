@@ -38,6 +38,23 @@ constexpr sample_t kPwmModScale = 0.5;
 // When filterEnvAmount=1.0 and envelope=1.0, cutoff increases by 10,000 Hz.
 constexpr sample_t kFilterEnvMaxHz = 10000.0;
 
+// Upper bound for Voice::SetControlRate() (samples per filter-modulation
+// update). Beyond ~1.3 ms at 48 kHz fast envelopes start to sound stepped.
+constexpr int kMaxControlRate = 64;
+
+// ============================================================================
+// Engine: Parameter Smoothing
+// ============================================================================
+
+// Default ramp time (seconds) for continuous parameters changed through
+// Engine::UpdateState() (gain, cutoff, resonance, mixer, FX mix/feedback/time).
+constexpr double kParamSmoothingSec = 0.02;
+
+// Smoothed parameters that feed coefficient or voice-patch recomputation
+// (cutoff, resonance, mixer, delay time) step once per this many samples;
+// gains and FX mixes ramp per sample.
+constexpr int kParamSmoothingInterval = 16;
+
 // ============================================================================
 // Voice: Portamento / Glide
 // ============================================================================
@@ -58,6 +75,20 @@ constexpr sample_t kGlideSnapThresholdHz = 0.01;
 // 20ms prevents audible clicks during voice stealing.
 constexpr sample_t kStolenFadeTimeSec = 0.020;
 
+// ============================================================================
+// Voice: Release-Tail Culling
+// ============================================================================
+
+// A releasing voice is retired once its post-envelope output has stayed
+// below the culling threshold (Engine::SetReleaseCulling) for this long.
+// Longer than the quiet stretch around a zero crossing of any audible tail.
+constexpr sample_t kReleaseCullHoldSec = 0.020;
+
+// Threshold the platforms enable: -120 dBFS is below the noise floor of a
+// 24-bit host mix; the Pico's 16-bit output bottoms out at -96 dBFS.
+constexpr sample_t kReleaseCullDesktopDb = -120.0;
+constexpr sample_t kReleaseCullEmbeddedDb = -96.0;
+
 // ============================================================================
 // Engine: Chorus FX
 // ============================================================================
@@ -117,6 +148,7 @@ static_assert(kGlideTimeConstant > 0.0);
 static_assert(kGlideSnapThresholdHz > 0.0 && kGlideSnapThresholdHz < 1.0,
               "snap threshold should be sub-Hz");
 static_assert(kStolenFadeTimeSec > 0.0);
+static_assert(kReleaseCullHoldSec > 0.0);
 static_assert(kChorusDepthMs > 0.0);
 static_assert(kMaxDelayMs > 0.0);
 static_assert(kDelayTimeToMs > 0.0);
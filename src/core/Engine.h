@@ -1,12 +1,16 @@
 #pragma once
 
 #include "DspConstants.h"
+#include "EventQueue.h"
 #include "SynthState.h"
 #include "VoiceManager.h"
 #include "types.h"
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <cstdint>
+#include <sea_dsp/sea_denormal.h>
+#include <sea_dsp/sea_linear_ramp.h>
 // Deploy guards: default ON so desktop/WASM builds are unaffected.
 // Pico CMakeLists sets these to 0 to save SRAM.
 #ifndef POLYSYNTH_DEPLOY_CHORUS
@@ -32,20 +36,38 @@
 
 namespace PolySynthCore {
 
-class Engine {
+// Top-level synth: event scheduling, parameter fan-out, voices and the FX
+// chain. T is the audio sample type of the whole signal path (voices, mix
+// bus, FX buffers); StateT is the precision of oscillator phase and filter
+// state (see BasicVoice). Engine is the sample_t instantiation.
+template <typename T, typename StateT = T>
+class BasicEngine {
 public:
-  Engine() : mSampleRate(44100.0) {}
-  ~Engine() = default;
+  using VoiceManager = BasicVoiceManager<T, StateT>;
+  using sample_type = T;
+
+#if defined(SEA_PLATFORM_EMBEDDED)
+  static constexpr size_t kMaxScheduledEvents = 32; // SRAM budget
+  static constexpr int kMaxScheduledStates = 1;
+#else
+  static constexpr size_t kMaxScheduledEvents = 128;
+  static constexpr int kMaxScheduledStates = 4;
+#endif
+
+  BasicEngine() : mSampleRate(44100.0) { mGain.Reset(T(1)); }
+  ~BasicEngine() = default;
 
   // --- Lifecycle ---
   void Init(double sampleRate) {
     mSampleRate = sampleRate;
     mVoiceManager.Init(sampleRate);
+    mStateApplied = false;
+    SetParamSmoothingTime(kParamSmoothingSec);
 #if POLYSYNTH_DEPLOY_CHORUS
     mChorus.Init(sampleRate);
 #endif
 #if POLYSYNTH_DEPLOY_DELAY
-    mDelay.Init(sampleRate, kMaxDelayMs);
+    mDelay.Init(sampleRate, T(kMaxDelayMs));
 #endif
 #if POLYSYNTH_DEPLOY_LIMITER
     mLimiter.Init(sampleRate);
@@ -55,6 +77,11 @@ public:
 
   void Reset() {
     mVoiceManager.Reset();
+    mStateApplied = false;
+    mEvents.Clear();
+    mStateSlotUsed.fill(false);
+    mControlSmoothing = false;
+    mFxSmoothing = false;
 #if POLYSYNTH_DEPLOY_DELAY
     mDelay.Clear();
 #endif
@@ -70,147 +97,370 @@ public:
 
   void OnNoteOff(int note) { mVoiceManager.OnNoteOff(note); }
 
-  void SetParameter(int /*paramNum*/, sample_t /*value*/) {
+  // --- Scheduled Events (sample-accurate) ---
+  // offset counts samples from the start of the next Process() call and may
+  // run past that block; later events stay queued for the following calls.
+  // Process() splits rendering at event offsets. If the queue (or, for
+  // ScheduleState(), every state slot) is full, the queued events due at or
+  // before the new event's offset are applied first and then the new event,
+  // so the order of events is kept but they sound early; false is returned.
+  bool ScheduleNoteOn(int offset, int note, int velocity) {
+    if (note < 0 || note > 127)
+      return false;
+    SynthEvent e;
+    e.offset = offset;
+    e.type = SynthEvent::Type::NoteOn;
+    e.note = static_cast<uint8_t>(note);
+    e.value = static_cast<uint8_t>(std::clamp(velocity, 0, 127));
+    return Schedule(e);
+  }
+
+  bool ScheduleNoteOff(int offset, int note) {
+    if (note < 0 || note > 127)
+      return false;
+    SynthEvent e;
+    e.offset = offset;
+    e.type = SynthEvent::Type::NoteOff;
+    e.note = static_cast<uint8_t>(note);
+    return Schedule(e);
+  }
+
+  bool ScheduleSustainPedal(int offset, bool down) {
+    SynthEvent e;
+    e.offset = offset;
+    e.type = SynthEvent::Type::SustainPedal;
+    e.value = down ? 1 : 0;
+    return Schedule(e);
+  }
+
+  // The state is copied into one of kMaxScheduledStates slots.
+  bool ScheduleState(int offset, const SynthState& state) {
+    for (int slot = 0; slot < kMaxScheduledStates; ++slot) {
+      if (mStateSlotUsed[slot])
+        continue;
+      SynthEvent e;
+      e.offset = offset;
+      e.type = SynthEvent::Type::State;
+      e.value = static_cast<uint8_t>(slot);
+      mScheduledStates[slot] = state;
+      mStateSlotUsed[slot] = true;
+      return Schedule(e);
+    }
+    DispatchEvents(std::max(0, offset));
+    UpdateState(state);
+    return false;
+  }
+
+  int GetPendingEventCount() const { return static_cast<int>(mEvents.Size()); }
+
+  void SetParameter(int /*paramNum*/, T /*value*/) {
     // Basic param dispatch could go here
   }
 
   // --- State Update (parameter fan-out) ---
+  // Called every audio block by the platform layers. Each setter group runs
+  // only when one of its inputs differs from the last applied state, so an
+  // unchanged state costs a handful of compares. Init(), Reset() and the
+  // direct setters below invalidate the cache and force a full re-apply.
+  //
+  // Continuous parameters (master gain, cutoff, resonance, oscillator mix,
+  // FX mix/feedback and delay time) ramp linearly to a changed value over
+  // the smoothing time instead of jumping; a full re-apply snaps them.
   void UpdateState(const SynthState& state) {
-    mGain = state.masterGain;
-
-    mVoiceManager.SetADSR(state.ampAttack, state.ampDecay, state.ampSustain,
-                          state.ampRelease);
-    mVoiceManager.SetFilterEnv(state.filterAttack, state.filterDecay,
-                               state.filterSustain, state.filterRelease);
-    mVoiceManager.SetFilter(state.filterCutoff, state.filterResonance,
-                            state.filterEnvAmount);
-    mVoiceManager.SetFilterModel(state.filterModel);
-
-    mVoiceManager.SetWaveformA(
-        static_cast<sea::Oscillator::WaveformType>(state.oscAWaveform));
-    mVoiceManager.SetWaveformB(
-        static_cast<sea::Oscillator::WaveformType>(state.oscBWaveform));
-    mVoiceManager.SetPulseWidthA(state.oscAPulseWidth);
-    mVoiceManager.SetPulseWidthB(state.oscBPulseWidth);
-    mVoiceManager.SetMixer(state.mixOscA, state.mixOscB,
-                           state.oscBFineTune * kFineTuneToCents);
-
-    mVoiceManager.SetLFO(state.lfoShape, state.lfoRate, state.lfoDepth);
-
-    mVoiceManager.SetPolyModOscBToFreqA(state.polyModOscBToFreqA);
-    mVoiceManager.SetPolyModOscBToPWM(state.polyModOscBToPWM);
-    mVoiceManager.SetPolyModOscBToFilter(state.polyModOscBToFilter);
-    mVoiceManager.SetPolyModFilterEnvToFreqA(state.polyModFilterEnvToFreqA);
-    mVoiceManager.SetPolyModFilterEnvToPWM(state.polyModFilterEnvToPWM);
-    mVoiceManager.SetPolyModFilterEnvToFilter(state.polyModFilterEnvToFilter);
-
-    mVoiceManager.SetGlideTime(state.glideTime);
-    mVoiceManager.SetPolyphonyLimit(state.polyphony);
-    mVoiceManager.SetAllocationMode(state.allocationMode);
-    mVoiceManager.SetStealPriority(state.stealPriority);
-    mVoiceManager.SetUnisonCount(state.unisonCount);
-    mVoiceManager.SetUnisonSpread(state.unisonSpread);
-    mVoiceManager.SetStereoSpread(state.stereoSpread);
+    if (Dirty(state, &SynthState::masterGain))
+      mGain.SetTarget(state.masterGain, SmoothingSamples());
+
+    if (Dirty(state, &SynthState::ampAttack, &SynthState::ampDecay,
+              &SynthState::ampSustain, &SynthState::ampRelease))
+      mVoiceManager.SetADSR(state.ampAttack, state.ampDecay, state.ampSustain,
+                            state.ampRelease);
+    if (Dirty(state, &SynthState::filterAttack, &SynthState::filterDecay,
+              &SynthState::filterSustain, &SynthState::filterRelease))
+      mVoiceManager.SetFilterEnv(state.filterAttack, state.filterDecay,
+                                 state.filterSustain, state.filterRelease);
+    if (Dirty(state, &SynthState::filterCutoff, &SynthState::filterResonance,
+              &SynthState::filterEnvAmount)) {
+      mFilterEnvAmount = state.filterEnvAmount;
+      SmoothControlRate(mCutoff, state.filterCutoff);
+      SmoothControlRate(mResonance, state.filterResonance);
+      mVoiceManager.SetFilter(mCutoff.Current(), mResonance.Current(),
+                              mFilterEnvAmount);
+    }
+    if (Dirty(state, &SynthState::filterModel))
+      mVoiceManager.SetFilterModel(state.filterModel);
+
+    if (Dirty(state, &SynthState::oscAWaveform))
+      mVoiceManager.SetWaveformA(
+          static_cast<sea::Oscillator::WaveformType>(state.oscAWaveform));
+    if (Dirty(state, &SynthState::oscBWaveform))
+      mVoiceManager.SetWaveformB(
+          static_cast<sea::Oscillator::WaveformType>(state.oscBWaveform));
+    if (Dirty(state, &SynthState::oscAPulseWidth))
+      mVoiceManager.SetPulseWidthA(state.oscAPulseWidth);
+    if (Dirty(state, &SynthState::oscBPulseWidth))
+      mVoiceManager.SetPulseWidthB(state.oscBPulseWidth);
+    if (Dirty(state, &SynthState::mixOscA, &SynthState::mixOscB,
+              &SynthState::oscBFineTune)) {
+      mDetuneCents = state.oscBFineTune * T(kFineTuneToCents);
+      SmoothControlRate(mMixA, state.mixOscA);
+      SmoothControlRate(mMixB, state.mixOscB);
+      mVoiceManager.SetMixer(mMixA.Current(), mMixB.Current(), mDetuneCents);
+    }
+
+    if (Dirty(state, &SynthState::lfoShape, &SynthState::lfoRate,
+              &SynthState::lfoDepth))
+      mVoiceManager.SetLFO(state.lfoShape, state.lfoRate, state.lfoDepth);
+
+    if (Dirty(state, &SynthState::polyModOscBToFreqA))
+      mVoiceManager.SetPolyModOscBToFreqA(state.polyModOscBToFreqA);
+    if (Dirty(state, &SynthState::polyModOscBToPWM))
+      mVoiceManager.SetPolyModOscBToPWM(state.polyModOscBToPWM);
+    if (Dirty(state, &SynthState::polyModOscBToFilter))
+      mVoiceManager.SetPolyModOscBToFilter(state.polyModOscBToFilter);
+    if (Dirty(state, &SynthState::polyModFilterEnvToFreqA))
+      mVoiceManager.SetPolyModFilterEnvToFreqA(state.polyModFilterEnvToFreqA);
+    if (Dirty(state, &SynthState::polyModFilterEnvToPWM))
+      mVoiceManager.SetPolyModFilterEnvToPWM(state.polyModFilterEnvToPWM);
+    if (Dirty(state, &SynthState::polyModFilterEnvToFilter))
+      mVoiceManager.SetPolyModFilterEnvToFilter(state.polyModFilterEnvToFilter);
+
+    if (Dirty(state, &SynthState::glideTime))
+      mVoiceManager.SetGlideTime(state.glideTime);
+    if (Dirty(state, &SynthState::polyphony))
+      mVoiceManager.SetPolyphonyLimit(state.polyphony);
+    if (Dirty(state, &SynthState::allocationMode))
+      mVoiceManager.SetAllocationMode(state.allocationMode);
+    if (Dirty(state, &SynthState::stealPriority))
+      mVoiceManager.SetStealPriority(state.stealPriority);
+    if (Dirty(state, &SynthState::unisonCount))
+      mVoiceManager.SetUnisonCount(state.unisonCount);
+    if (Dirty(state, &SynthState::unisonSpread))
+      mVoiceManager.SetUnisonSpread(state.unisonSpread);
+    if (Dirty(state, &SynthState::stereoSpread))
+      mVoiceManager.SetStereoSpread(state.stereoSpread);
 
 #if POLYSYNTH_DEPLOY_CHORUS
-    SetChorus(state.fxChorusRate, state.fxChorusDepth, state.fxChorusMix);
+    if (Dirty(state, &SynthState::fxChorusRate, &SynthState::fxChorusDepth,
+              &SynthState::fxChorusMix)) {
+      SmoothAudioRate(mChorusMix, state.fxChorusMix);
+      ApplyChorus(state.fxChorusRate, state.fxChorusDepth, mChorusMix.Current());
+    }
 #endif
 #if POLYSYNTH_DEPLOY_DELAY
-    SetDelay(state.fxDelayTime, state.fxDelayFeedback, state.fxDelayMix);
+    if (Dirty(state, &SynthState::fxDelayTime, &SynthState::fxDelayFeedback,
+              &SynthState::fxDelayMix)) {
+      SmoothControlRate(mDelayTime, state.fxDelayTime);
+      SmoothAudioRate(mDelayFeedback, state.fxDelayFeedback);
+      SmoothAudioRate(mDelayMix, state.fxDelayMix);
+      ApplyDelay(mDelayTime.Current(), mDelayFeedback.Current(),
+                 mDelayMix.Current());
+    }
 #endif
 #if POLYSYNTH_DEPLOY_LIMITER
-    SetLimiter(state.fxLimiterThreshold, kLimiterLookaheadMs, kLimiterReleaseMs);
+    if (Dirty(state, &SynthState::fxLimiterThreshold))
+      mLimiter.SetParams(state.fxLimiterThreshold, T(kLimiterLookaheadMs),
+                         T(kLimiterReleaseMs));
 #endif
+
+    mAppliedState = state;
+    mStateApplied = true;
+  }
+
+  // Number of setter groups UpdateState() has pushed down since construction
+  // (diagnostic; an unchanged state must not advance it).
+  uint32_t GetStateApplyCount() const { return mStateApplyCount; }
+
+  // Ramp time for the smoothed UpdateState() parameters; 0 disables
+  // smoothing. Rounded to whole kParamSmoothingInterval periods.
+  void SetParamSmoothingTime(double seconds) {
+    mSmoothingSteps = static_cast<int>(
+        std::max(0.0, seconds) * mSampleRate / kParamSmoothingInterval + 0.5);
+  }
+
+  // True while a smoothed parameter is still ramping towards its target.
+  bool IsSmoothing() const {
+    return mControlSmoothing || mFxSmoothing || mGain.IsRamping();
   }
 
   // --- High Level Setters ---
-  void SetADSR(sample_t a, sample_t d, sample_t s, sample_t r) {
+  void SetADSR(T a, T d, T s, T r) {
+    mStateApplied = false;
     mVoiceManager.SetADSR(a, d, s, r);
   }
-  void SetFilterEnv(sample_t a, sample_t d, sample_t s, sample_t r) {
+  void SetFilterEnv(T a, T d, T s, T r) {
+    mStateApplied = false;
     mVoiceManager.SetFilterEnv(a, d, s, r);
   }
-  void SetFilter(sample_t cutoff, sample_t res, sample_t envAmount) {
+  void SetFilter(T cutoff, T res, T envAmount) {
+    mStateApplied = false;
+    mCutoff.Reset(cutoff);
+    mResonance.Reset(res);
     mVoiceManager.SetFilter(cutoff, res, envAmount);
   }
   void SetWaveform(sea::Oscillator::WaveformType type) {
+    mStateApplied = false;
     mVoiceManager.SetWaveform(type);
   }
   void SetWaveformA(sea::Oscillator::WaveformType type) {
+    mStateApplied = false;
     mVoiceManager.SetWaveformA(type);
   }
   void SetWaveformB(sea::Oscillator::WaveformType type) {
+    mStateApplied = false;
     mVoiceManager.SetWaveformB(type);
   }
 
-  void SetPulseWidth(sample_t pw) { mVoiceManager.SetPulseWidth(pw); }
-  void SetPulseWidthA(sample_t pw) { mVoiceManager.SetPulseWidthA(pw); }
-  void SetPulseWidthB(sample_t pw) { mVoiceManager.SetPulseWidthB(pw); }
+  void SetPulseWidth(T pw) {
+    mVoiceManager.SetPulseWidth(pw);
+    mStateApplied = false;
+  }
+  void SetPulseWidthA(T pw) {
+    mVoiceManager.SetPulseWidthA(pw);
+    mStateApplied = false;
+  }
+  void SetPulseWidthB(T pw) {
+    mVoiceManager.SetPulseWidthB(pw);
+    mStateApplied = false;
+  }
 
-  void SetMixer(sample_t mixA, sample_t mixB, sample_t detuneB) {
+  void SetMixer(T mixA, T mixB, T detuneB) {
+    mStateApplied = false;
+    mMixA.Reset(mixA);
+    mMixB.Reset(mixB);
     mVoiceManager.SetMixer(mixA, mixB, detuneB);
   }
 
-  void SetLFO(int type, sample_t rate, sample_t depth) {
+  void SetLFO(int type, T rate, T depth) {
+    mStateApplied = false;
     mVoiceManager.SetLFO(type, rate, depth);
   }
-  void SetLFORouting(sample_t pitch, sample_t filter, sample_t amp,
-                     sample_t pan = 0.0) {
+  void SetLFORouting(T pitch, T filter, T amp,
+                     T pan = 0.0) {
     mVoiceManager.SetLFORouting(pitch, filter, amp, pan);
   }
+  // Per-voice (default), shared or retriggered shared LFO; see
+  // VoiceManager::SetLFOMode(). Survives Init().
+  void SetLFOMode(LfoMode mode) { mVoiceManager.SetLFOMode(mode); }
 
-  void SetPolyModOscBToFreqA(sample_t amount) {
+  void SetPolyModOscBToFreqA(T amount) {
+    mStateApplied = false;
     mVoiceManager.SetPolyModOscBToFreqA(amount);
   }
-  void SetPolyModOscBToPWM(sample_t amount) {
+  void SetPolyModOscBToPWM(T amount) {
+    mStateApplied = false;
     mVoiceManager.SetPolyModOscBToPWM(amount);
   }
-  void SetPolyModOscBToFilter(sample_t amount) {
+  void SetPolyModOscBToFilter(T amount) {
+    mStateApplied = false;
     mVoiceManager.SetPolyModOscBToFilter(amount);
   }
-  void SetPolyModFilterEnvToFreqA(sample_t amount) {
+  void SetPolyModFilterEnvToFreqA(T amount) {
+    mStateApplied = false;
     mVoiceManager.SetPolyModFilterEnvToFreqA(amount);
   }
-  void SetPolyModFilterEnvToPWM(sample_t amount) {
+  void SetPolyModFilterEnvToPWM(T amount) {
+    mStateApplied = false;
     mVoiceManager.SetPolyModFilterEnvToPWM(amount);
   }
-  void SetPolyModFilterEnvToFilter(sample_t amount) {
+  void SetPolyModFilterEnvToFilter(T amount) {
+    mStateApplied = false;
     mVoiceManager.SetPolyModFilterEnvToFilter(amount);
   }
 
   // --- VoiceManager Forwarding Setters ---
-  void SetGlideTime(sample_t t) { mVoiceManager.SetGlideTime(t); }
-  void SetPolyphonyLimit(int n) { mVoiceManager.SetPolyphonyLimit(n); }
-  void SetAllocationMode(int mode) { mVoiceManager.SetAllocationMode(mode); }
-  void SetStealPriority(int priority) { mVoiceManager.SetStealPriority(priority); }
-  void SetUnisonCount(int count) { mVoiceManager.SetUnisonCount(count); }
-  void SetUnisonSpread(sample_t spread) { mVoiceManager.SetUnisonSpread(spread); }
-  void SetStereoSpread(sample_t spread) { mVoiceManager.SetStereoSpread(spread); }
+  void SetGlideTime(T t) {
+    mVoiceManager.SetGlideTime(t);
+    mStateApplied = false;
+  }
+  void SetPolyphonyLimit(int n) {
+    mVoiceManager.SetPolyphonyLimit(n);
+    mStateApplied = false;
+  }
+  void SetAllocationMode(int mode) {
+    mVoiceManager.SetAllocationMode(mode);
+    mStateApplied = false;
+  }
+  void SetStealPriority(int priority) {
+    mVoiceManager.SetStealPriority(priority);
+    mStateApplied = false;
+  }
+  void SetUnisonCount(int count) {
+    mVoiceManager.SetUnisonCount(count);
+    mStateApplied = false;
+  }
+  void SetUnisonSpread(T spread) {
+    mVoiceManager.SetUnisonSpread(spread);
+    mStateApplied = false;
+  }
+  void SetStereoSpread(T spread) {
+    mVoiceManager.SetStereoSpread(spread);
+    mStateApplied = false;
+  }
   void OnSustainPedal(bool down) { mVoiceManager.OnSustainPedal(down); }
-  void SetFilterModel(int model) { mVoiceManager.SetFilterModel(model); }
+  void SetFilterModel(int model) {
+    mVoiceManager.SetFilterModel(model);
+    mStateApplied = false;
+  }
+  // Retires releasing voices whose output has stayed below thresholdDb
+  // (e.g. -96 or -120 dBFS) for kReleaseCullHoldSec, freeing their slots
+  // early. 0 dB or above disables it (the default). Survives Init().
+  void SetReleaseCulling(T thresholdDb) {
+    mVoiceManager.SetReleaseCulling(thresholdDb);
+  }
+  // Naive (default) or PolyBLEP band-limited waveforms for oscillators A/B.
+  void SetOscillatorAntialias(sea::OscillatorAntialias oscA,
+                              sea::OscillatorAntialias oscB) {
+    mVoiceManager.SetOscillatorAntialias(oscA, oscB);
+  }
+  // Filter cutoff -> coefficient lookup tables instead of exact Tan/Sin/Cos
+  // (off by default); see VoiceManager::SetFilterTables().
+  void SetFilterTables(bool enabled) { mVoiceManager.SetFilterTables(enabled); }
+  // Per-voice objects (default) or the structure-of-arrays voice bank; see
+  // VoiceManager::SetVoiceLayout().
+  void SetVoiceLayout(VoiceLayout layout) {
+    mVoiceManager.SetVoiceLayout(layout);
+  }
+  // Samples per filter-modulation update (1 = every sample, the default).
+  void SetControlRate(int samples) { mVoiceManager.SetControlRate(samples); }
+  // Voice filter oversampling (1, 2 or 4; optionally the oscillators too).
+  // Adds GetOversamplingLatency() samples of delay for the host to
+  // compensate. Not realtime-safe.
+  void SetOversampling(int factor, bool oscillators = false) {
+    mVoiceManager.SetOversampling(factor, oscillators);
+  }
+  T GetOversamplingLatency() const {
+    return mVoiceManager.GetOversamplingLatency();
+  }
+#if POLYSYNTH_PARALLEL_VOICES
+  // Cores used for voice rendering (1 = serial). Not realtime-safe.
+  void SetRenderThreads(int threads) { mVoiceManager.SetRenderThreads(threads); }
+#endif
 
   // --- FX Setters ---
 #if POLYSYNTH_DEPLOY_CHORUS
-  void SetChorus(sample_t rateHz, sample_t depth, sample_t mix) {
-    mChorus.SetRate(rateHz);
-    mChorus.SetDepth(depth * kChorusDepthMs);
-    mChorus.SetMix(mix);
+  void SetChorus(T rateHz, T depth, T mix) {
+    mStateApplied = false;
+    mChorusMix.Reset(mix);
+    ApplyChorus(rateHz, depth, mix);
   }
 #endif
 #if POLYSYNTH_DEPLOY_DELAY
-  void SetDelay(sample_t timeSec, sample_t feedback, sample_t mix) {
-    mDelay.SetTime(timeSec * kDelayTimeToMs);
-    mDelay.SetFeedback(feedback * kDelayFeedbackScale);
-    mDelay.SetMix(mix * kDelayMixScale);
-  }
-  void SetDelayTempo(sample_t bpm, sample_t division) {
+  void SetDelay(T timeSec, T feedback, T mix) {
+    mStateApplied = false;
+    mDelayTime.Reset(timeSec);
+    mDelayFeedback.Reset(feedback);
+    mDelayMix.Reset(mix);
+    ApplyDelay(timeSec, feedback, mix);
+  }
+  void SetDelayTempo(T bpm, T division) {
     // Basic fallback for now
-    sample_t beatSec = 60.0 / bpm;
-    SetDelay(beatSec * division, kTempoDelayFeedbackPct, 0.0);
+    T beatSec = 60.0 / bpm;
+    SetDelay(beatSec * division, T(kTempoDelayFeedbackPct), 0.0);
   }
 #endif
 #if POLYSYNTH_DEPLOY_LIMITER
-  void SetLimiter(sample_t threshold, sample_t lookaheadMs, sample_t releaseMs) {
+  void SetLimiter(T threshold, T lookaheadMs, T releaseMs) {
+    mStateApplied = false;
     mLimiter.SetParams(threshold, lookaheadMs, releaseMs);
   }
 #endif
@@ -268,89 +518,264 @@ public:
   }
 
   // Diagnostic: process with per-voice peak tracking
-  void ProcessDiag(sample_t &left, sample_t &right, float* voicePeaks) {
-    sample_t l, r;
+  void ProcessDiag(T &left, T &right, float* voicePeaks) {
+    T l, r;
     mVoiceManager.ProcessStereoDiag(l, r, voicePeaks);
-    l *= mGain;
-    r *= mGain;
+    const T gain = mGain.Next();
+    l *= gain;
+    r *= gain;
     left = l;
     right = r;
   }
 
   // --- Audio Processing ---
-  void Process(sample_t &left, sample_t &right) {
-    sample_t l, r;
+  void Process(T &left, T &right) {
+    if (!mEvents.Empty()) {
+      DispatchEvents(0);
+      mEvents.Advance(1);
+    }
+    if (mControlSmoothing) {
+      if (mSmoothingCountdown == 0)
+        TickControlSmoothing();
+      --mSmoothingCountdown;
+    }
+    T l, r;
     mVoiceManager.ProcessStereo(l, r);
 
-    l *= mGain;
-    r *= mGain;
+    const T gain = mGain.Next();
+    l *= gain;
+    r *= gain;
 
-#if POLYSYNTH_DEPLOY_CHORUS || POLYSYNTH_DEPLOY_DELAY || POLYSYNTH_DEPLOY_LIMITER
-    sample_t fxL = l, fxR = r;
-#if POLYSYNTH_DEPLOY_CHORUS
-    mChorus.Process(fxL, fxR, &fxL, &fxR);
-#endif
-#if POLYSYNTH_DEPLOY_DELAY
-    mDelay.Process(fxL, fxR, &fxL, &fxR);
-#endif
-#if POLYSYNTH_DEPLOY_LIMITER
-    mLimiter.Process(fxL, fxR);
-#endif
-    left = fxL;
-    right = fxR;
-#else
+    TickFxSmoothing();
+    ProcessFX(l, r);
     left = l;
     right = r;
-#endif
   }
 
-  void Process(sample_t ** /*inputs*/, sample_t **outputs, int nFrames,
+  // Host block entry point. Voices render in kRenderChunkSize sub-blocks via
+  // VoiceManager::ProcessStereoBlock(), split further at scheduled event
+  // offsets and, while a smoothed parameter ramps, at its control steps; the
+  // FX chain stays per-sample. Output matches calling the single-sample
+  // Process() nFrames times. Denormals are flushed for the duration of the
+  // block, so release and feedback tails decay to zero instead of stalling
+  // the FPU.
+  void Process(T ** /*inputs*/, T **outputs, int nFrames,
                int nChans) {
-    for (int i = 0; i < nFrames; ++i) {
-      sample_t l, r;
-      mVoiceManager.ProcessStereo(l, r);
+    sea::ScopedFlushDenormals noDenormals;
+    int offset = 0;
+    while (offset < nFrames) {
+      DispatchEvents(offset);
+      if (mControlSmoothing && mSmoothingCountdown == 0)
+        TickControlSmoothing();
+      int n = std::min(kRenderChunkSize, nFrames - offset);
+      n = std::min(n, mEvents.NextOffset(nFrames) - offset);
+      if (mControlSmoothing) {
+        n = std::min(n, mSmoothingCountdown);
+        mSmoothingCountdown -= n;
+      }
+      mVoiceManager.ProcessStereoBlock(mBusL.data(), mBusR.data(), n);
+
+      for (int i = 0; i < n; ++i) {
+        const T gain = mGain.Next();
+        T l = mBusL[i] * gain;
+        T r = mBusR[i] * gain;
+        TickFxSmoothing();
+        ProcessFX(l, r);
+        if (nChans > 0)
+          outputs[0][offset + i] = l;
+        if (nChans > 1)
+          outputs[1][offset + i] = r;
+      }
+      offset += n;
+    }
+    mEvents.Advance(nFrames);
 
-      l *= mGain;
-      r *= mGain;
+    UpdateVisualization();
+  }
 
-#if POLYSYNTH_DEPLOY_CHORUS || POLYSYNTH_DEPLOY_DELAY || POLYSYNTH_DEPLOY_LIMITER
-      sample_t fxL = l, fxR = r;
+private:
+  bool Schedule(SynthEvent e) {
+    e.offset = std::max(0, e.offset);
+    if (mEvents.Push(e))
+      return true;
+    DispatchEvents(e.offset);
+    ApplyEvent(e);
+    return false;
+  }
+
+  // Applies every queued event due at or before offset.
+  void DispatchEvents(int offset) {
+    SynthEvent e;
+    while (mEvents.PopDue(offset, e))
+      ApplyEvent(e);
+  }
+
+  void ApplyEvent(const SynthEvent& e) {
+    switch (e.type) {
+    case SynthEvent::Type::NoteOn:
+      mVoiceManager.OnNoteOn(e.note, e.value);
+      break;
+    case SynthEvent::Type::NoteOff:
+      mVoiceManager.OnNoteOff(e.note);
+      break;
+    case SynthEvent::Type::SustainPedal:
+      mVoiceManager.OnSustainPedal(e.value != 0);
+      break;
+    case SynthEvent::Type::State:
+      UpdateState(mScheduledStates[e.value]);
+      mStateSlotUsed[e.value] = false;
+      break;
+    }
+  }
+
+  // True when any of the given SynthState fields differs from the last
+  // applied state (or nothing has been applied yet); counts the group.
+  template <typename... Fields>
+  bool Dirty(const SynthState &next, Fields... fields) {
+    const bool dirty = !mStateApplied ||
+                       ((next.*fields != mAppliedState.*fields) || ...);
+    mStateApplyCount += dirty ? 1u : 0u;
+    return dirty;
+  }
+
+  // Smoothed parameters: a new target ramps over the smoothing time, except
+  // on a full re-apply (first UpdateState after Init/Reset/a direct setter),
+  // which snaps. The increment is computed here, once per changed block.
+  int SmoothingSamples() const {
+    return mStateApplied ? mSmoothingSteps * kParamSmoothingInterval : 0;
+  }
+
+  void SmoothAudioRate(sea::LinearRamp<T> &ramp, T target) {
+    ramp.SetTarget(target, SmoothingSamples());
+    mFxSmoothing = mFxSmoothing || ramp.IsRamping();
+  }
+
+  void SmoothControlRate(sea::LinearRamp<T> &ramp, T target) {
+    ramp.SetTarget(target, mStateApplied ? mSmoothingSteps : 0);
+    if (ramp.IsRamping()) {
+      mControlSmoothing = true;
+      mSmoothingCountdown = 0; // first step lands on the next sample
+    }
+  }
+
+  // One control step: pushes the ramped values that drive coefficient or
+  // patch recomputation. Runs every kParamSmoothingInterval samples.
+  void TickControlSmoothing() {
+    mSmoothingCountdown = kParamSmoothingInterval;
+    bool ramping = false;
+    if (mCutoff.IsRamping() || mResonance.IsRamping()) {
+      mVoiceManager.SetFilter(mCutoff.Next(), mResonance.Next(),
+                              mFilterEnvAmount);
+      ramping = true;
+    }
+    if (mMixA.IsRamping() || mMixB.IsRamping()) {
+      mVoiceManager.SetMixer(mMixA.Next(), mMixB.Next(), mDetuneCents);
+      ramping = true;
+    }
+#if POLYSYNTH_DEPLOY_DELAY
+    if (mDelayTime.IsRamping()) {
+      mDelay.SetTime(mDelayTime.Next() * T(kDelayTimeToMs));
+      ramping = true;
+    }
+#endif
+    mControlSmoothing = ramping;
+  }
+
+  // Per-sample FX ramps (mix/feedback only; no coefficient work).
+  SEA_INLINE void TickFxSmoothing() {
+    if (!mFxSmoothing)
+      return;
+    bool ramping = false;
 #if POLYSYNTH_DEPLOY_CHORUS
-      mChorus.Process(fxL, fxR, &fxL, &fxR);
+    if (mChorusMix.IsRamping()) {
+      mChorus.SetMix(mChorusMix.Next());
+      ramping = true;
+    }
 #endif
 #if POLYSYNTH_DEPLOY_DELAY
-      mDelay.Process(fxL, fxR, &fxL, &fxR);
+    if (mDelayFeedback.IsRamping()) {
+      mDelay.SetFeedback(mDelayFeedback.Next() * T(kDelayFeedbackScale));
+      ramping = true;
+    }
+    if (mDelayMix.IsRamping()) {
+      mDelay.SetMix(mDelayMix.Next() * T(kDelayMixScale));
+      ramping = true;
+    }
 #endif
-#if POLYSYNTH_DEPLOY_LIMITER
-      mLimiter.Process(fxL, fxR);
+    mFxSmoothing = ramping;
+  }
+
+#if POLYSYNTH_DEPLOY_CHORUS
+  void ApplyChorus(T rateHz, T depth, T mix) {
+    mChorus.SetRate(rateHz);
+    mChorus.SetDepth(depth * T(kChorusDepthMs));
+    mChorus.SetMix(mix);
+  }
 #endif
-      if (nChans > 0)
-        outputs[0][i] = fxL;
-      if (nChans > 1)
-        outputs[1][i] = fxR;
-#else
-      if (nChans > 0)
-        outputs[0][i] = l;
-      if (nChans > 1)
-        outputs[1][i] = r;
+#if POLYSYNTH_DEPLOY_DELAY
+  void ApplyDelay(T timeSec, T feedback, T mix) {
+    mDelay.SetTime(timeSec * T(kDelayTimeToMs));
+    mDelay.SetFeedback(feedback * T(kDelayFeedbackScale));
+    mDelay.SetMix(mix * T(kDelayMixScale));
+  }
 #endif
-    }
 
-    UpdateVisualization();
+  SEA_INLINE void ProcessFX(T &left, T &right) {
+#if POLYSYNTH_DEPLOY_CHORUS
+    mChorus.Process(left, right, &left, &right);
+#endif
+#if POLYSYNTH_DEPLOY_DELAY
+    mDelay.Process(left, right, &left, &right);
+#endif
+#if POLYSYNTH_DEPLOY_LIMITER
+    mLimiter.Process(left, right);
+#endif
+    (void)left;
+    (void)right;
   }
 
-private:
   double mSampleRate;
-  sample_t mGain = 1.0;
+  sea::LinearRamp<T> mGain;
   VoiceManager mVoiceManager;
+  std::array<T, kRenderChunkSize> mBusL{};
+  std::array<T, kRenderChunkSize> mBusR{};
+
+  // Last state pushed by UpdateState(); only trusted while mStateApplied.
+  SynthState mAppliedState{};
+  bool mStateApplied = false;
+  uint32_t mStateApplyCount = 0;
+
+  // Parameter smoothing (see UpdateState()).
+  int mSmoothingSteps = 0;     // control steps per ramp
+  int mSmoothingCountdown = 0; // samples until the next control step
+  bool mControlSmoothing = false;
+  bool mFxSmoothing = false;
+  sea::LinearRamp<T> mCutoff;
+  sea::LinearRamp<T> mResonance;
+  sea::LinearRamp<T> mMixA;
+  sea::LinearRamp<T> mMixB;
+  T mFilterEnvAmount = 0.0;
+  T mDetuneCents = 0.0;
+#if POLYSYNTH_DEPLOY_CHORUS
+  sea::LinearRamp<T> mChorusMix;
+#endif
+#if POLYSYNTH_DEPLOY_DELAY
+  sea::LinearRamp<T> mDelayTime;
+  sea::LinearRamp<T> mDelayFeedback;
+  sea::LinearRamp<T> mDelayMix;
+#endif
+
+  EventQueue<kMaxScheduledEvents> mEvents;
+  std::array<SynthState, kMaxScheduledStates> mScheduledStates{};
+  std::array<bool, kMaxScheduledStates> mStateSlotUsed{};
 #if POLYSYNTH_DEPLOY_CHORUS
-  sea::VintageChorus<sample_t> mChorus;
+  sea::VintageChorus<T> mChorus;
 #endif
 #if POLYSYNTH_DEPLOY_DELAY
-  sea::VintageDelay<sample_t> mDelay;
+  sea::VintageDelay<T> mDelay;
 #endif
 #if POLYSYNTH_DEPLOY_LIMITER
-  sea::LookaheadLimiter<sample_t> mLimiter;
+  sea::LookaheadLimiter<T> mLimiter;
 #endif
 
   // Visualization state (written by Audio thread, read by UI thread)
@@ -359,4 +784,10 @@ private:
   std::atomic<uint64_t> mVisualHeldNotesHigh{0};
 };
 
+using Engine = BasicEngine<sample_t>;
+
+// Float audio path (voices, mix bus, FX buffers) with double-precision
+// oscillator/LFO phase and filter state.
+using MixedPrecisionEngine = BasicEngine<float, double>;
+
 } // namespace PolySynthCore
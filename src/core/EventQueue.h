@@ -0,0 +1,92 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace PolySynthCore {
+
+/// A note/pedal/state change scheduled at a sample offset.
+struct SynthEvent {
+  enum class Type : uint8_t { NoteOn, NoteOff, SustainPedal, State };
+
+  int offset = 0; ///< samples from the start of the next Process() call
+  Type type = Type::NoteOn;
+  uint8_t note = 0;  ///< NoteOn / NoteOff
+  uint8_t value = 0; ///< velocity, pedal down (0/1) or state slot
+};
+
+/// Fixed-capacity queue of SynthEvents kept sorted by offset. Events with
+/// equal offsets keep their insertion order. No allocation; single-threaded
+/// (audio thread only).
+template <size_t Capacity> class EventQueue {
+  static_assert(Capacity > 0, "Capacity must be > 0");
+
+public:
+  /// Inserts an event in offset order. Returns false if the queue is full.
+  bool Push(const SynthEvent &event) {
+    if (mCount == Capacity)
+      return false;
+    if (mHead + mCount == Capacity)
+      Compact();
+    size_t pos = mHead + mCount;
+    while (pos > mHead && mEvents[pos - 1].offset > event.offset) {
+      mEvents[pos] = mEvents[pos - 1];
+      --pos;
+    }
+    mEvents[pos] = event;
+    ++mCount;
+    return true;
+  }
+
+  bool Empty() const { return mCount == 0; }
+  size_t Size() const { return mCount; }
+
+  /// Offset of the earliest pending event, or limit if there is none before it.
+  int NextOffset(int limit) const {
+    if (mCount == 0 || mEvents[mHead].offset > limit)
+      return limit;
+    return mEvents[mHead].offset;
+  }
+
+  /// Pops the earliest event if it is due at or before offset.
+  bool PopDue(int offset, SynthEvent &out) {
+    if (mCount == 0 || mEvents[mHead].offset > offset)
+      return false;
+    out = mEvents[mHead];
+    ++mHead;
+    --mCount;
+    return true;
+  }
+
+  /// Moves the time origin forward by n samples (after a rendered block).
+  void Advance(int n) {
+    if (mCount == 0) {
+      mHead = 0;
+      return;
+    }
+    Compact();
+    for (size_t i = 0; i < mCount; ++i)
+      mEvents[i].offset = (mEvents[i].offset > n) ? mEvents[i].offset - n : 0;
+  }
+
+  void Clear() {
+    mHead = 0;
+    mCount = 0;
+  }
+
+private:
+  void Compact() {
+    if (mHead == 0)
+      return;
+    for (size_t i = 0; i < mCount; ++i)
+      mEvents[i] = mEvents[mHead + i];
+    mHead = 0;
+  }
+
+  std::array<SynthEvent, Capacity> mEvents{};
+  size_t mHead = 0;
+  size_t mCount = 0;
+};
+
+} // namespace PolySynthCore
@@ -0,0 +1,127 @@
+#pragma once
+
+#include "types.h"
+#include <cmath>
+#include <sea_dsp/sea_lfo.h>
+#include <sea_dsp/sea_math.h>
+
+namespace PolySynthCore {
+
+// Where a VoiceManager's voices take their LFO value from.
+enum class LfoMode {
+  Free,      // one shared, free-running LFO; every voice reads the same value
+  Retrigger, // shared LFO; each voice's cycle restarts at its NoteOn
+  PerVoice   // each voice runs its own LFO, advancing only while it sounds
+};
+
+// The shared LFO of the Free and Retrigger modes. VoiceManager owns one,
+// binds it to its voices (see Voice::BindLfoBus()) and calls Render() once
+// per block before the voices render; voices then read the block's values
+// in order instead of each running an identical sea::LFO. A Free voice
+// reads Value(k), the same sample a per-voice LFO would have produced. A
+// retriggered voice stores the bus phase at its NoteOn (RetriggerOffset())
+// and reads Rotated(k): the sine is turned back by that offset with one
+// complex rotation against the quadrature (cosine) values the bus renders
+// alongside, the other waveforms are re-evaluated at the shifted phase,
+// which costs no trig.
+template <typename T, typename PhaseT> class BasicLfoBus {
+public:
+  // A voice's retrigger point: bus phase (cycles) and its cosine and sine.
+  struct Offset {
+    T phase = T(0);
+    T cos = T(1);
+    T sin = T(0);
+  };
+
+  // Same defaults as a voice's own LFO after Voice::Init().
+  void Init(T sampleRate) {
+    mLfo.Init(sampleRate);
+    SetLFO(0, T(5), T(0));
+    mLen = 0;
+  }
+
+  void SetLFO(int type, T rate, T depth) {
+    mLfo.SetWaveform(type);
+    mLfo.SetRate(rate);
+    mLfo.SetDepth(depth);
+  }
+
+  // Renders the next n (<= kRenderChunkSize) values. quadrature also fills
+  // the phase/cosine values Rotated() needs.
+  void Render(int n, bool quadrature) {
+    const bool sine = mLfo.GetWaveform() == 0;
+    const T depth = mLfo.GetDepth();
+    for (int k = 0; k < n; ++k) {
+      if (quadrature) {
+        const T phase = mLfo.GetPhase();
+        mPhase[k] = phase;
+        if (sine)
+          mQuad[k] = T(sea::Math::Cos(kTwoPi * sea::Real(phase))) * depth;
+      }
+      mValue[k] = mLfo.Process();
+    }
+    mLen = n;
+  }
+
+  // Moves the LFO on by n samples nobody reads, in O(1) (no values are
+  // rendered).
+  void Skip(int n) {
+    mLfo.Advance(static_cast<uint64_t>(n));
+    mLen = 0;
+  }
+
+  // Retrigger mode: voices take a RetriggerOffset() at NoteOn and read
+  // Rotated() values (VoiceManager renders with quadrature).
+  void SetRetrigger(bool retrigger) { mRetrigger = retrigger; }
+  bool IsRetrigger() const { return mRetrigger; }
+
+  int GetLength() const { return mLen; }
+
+  SEA_INLINE T Value(int k) const { return mValue[k]; }
+
+  // The value a voice retriggered at o reads at block position k. Needs a
+  // Render() with quadrature.
+  SEA_INLINE T Rotated(int k, const Offset &o) const {
+    const int waveform = mLfo.GetWaveform();
+    if (waveform == 0) // sin(a - b) = sin a cos b - cos a sin b
+      return mValue[k] * o.cos - mQuad[k] * o.sin;
+    T p = mPhase[k] - o.phase;
+    if (p < T(0))
+      p += T(1);
+    T out = T(0);
+    switch (waveform) {
+    case 1: // Triangle
+      out = T(4) * std::abs(p - T(0.5)) - T(1);
+      break;
+    case 2: // Square
+      out = (p < T(0.5)) ? T(1) : T(-1);
+      break;
+    case 3: // Saw
+      out = T(2) * p - T(1);
+      break;
+    default:
+      break;
+    }
+    return out * mLfo.GetDepth();
+  }
+
+  // Offset for a voice whose cycle starts at the next rendered sample.
+  Offset RetriggerOffset() const {
+    Offset o;
+    o.phase = mLfo.GetPhase();
+    const sea::Real angle = kTwoPi * sea::Real(o.phase);
+    o.cos = T(sea::Math::Cos(angle));
+    o.sin = T(sea::Math::Sin(angle));
+    return o;
+  }
+
+private:
+  sea::BasicLFO<T, PhaseT> mLfo;
+  T mValue[kRenderChunkSize] = {};
+  T mQuad[kRenderChunkSize] = {};
+  T mPhase[kRenderChunkSize] = {};
+  int mLen = 0;
+  bool mRetrigger = false;
+};
+
+} // namespace PolySynthCore
@@ -1,15 +1,21 @@
 #pragma once
 
 #include "DspConstants.h"
+#include "LfoBus.h"
+#include "VoicePatchParams.h"
 #include "types.h"
 #include <algorithm>
+#include <cassert>
 #include <cmath>
 #include <sea_dsp/sea_adsr.h>
 #include <sea_dsp/sea_biquad_filter.h>
 #include <sea_dsp/sea_cascade_filter.h>
+#include <sea_dsp/sea_cutoff_table.h>
 #include <sea_dsp/sea_ladder_filter.h>
+#include <sea_dsp/sea_ladder_filter_lanes.h>
 #include <sea_dsp/sea_lfo.h>
 #include <sea_dsp/sea_oscillator.h>
+#include <sea_dsp/sea_oversampler.h>
 
 namespace PolySynthCore {
 
@@ -47,42 +53,88 @@ inline sample_t midiNoteToFreq(int note) {
     return sample_t(440) * std::pow(sample_t(2), (note - sample_t(69)) / sample_t(12));
 }
 
-class Voice {
+template <typename T, typename StateT, int Lanes> class BasicVoiceBank;
+
+// One synth voice. T is the audio sample type (oscillator outputs, mixer,
+// envelopes, patch parameters); StateT holds the state that accumulates
+// rounding error over time (oscillator/LFO phase unless
+// POLYSYNTH_INTEGER_PHASE, filter integrators) and may be wider than T.
+// Voice is the sample_t instantiation.
+template <typename T, typename StateT = T>
+class BasicVoice {
 public:
-  enum class FilterModel { Classic, Ladder, Cascade12, Cascade24 };
+  using FilterModel = VoiceFilterModel;
+  using PatchParams = BasicVoicePatchParams<T>;
+  using sample_type = T;
+  using PhaseT = std::conditional_t<POLYSYNTH_INTEGER_PHASE != 0, uint32_t,
+                                    StateT>;
+  using LfoBus = BasicLfoBus<T, PhaseT>;
+  static constexpr int kMaxOversampling = sea::Oversampler<StateT>::kMaxFactor;
+
+  // Per-chunk envelope buffers for ProcessBlock(), supplied by the caller.
+  struct EnvScratch {
+    T filterEnv[kRenderChunkSize];
+    T ampEnv[kRenderChunkSize];
+  };
+
+  BasicVoice() = default;
+
+  // Patch parameters are read from a PatchParams block. VoiceManager binds
+  // all of its voices to one shared block and edits that directly; a
+  // StandaloneVoice (see below) owns a block of its own. The patch setters
+  // below edit the voice's own block and must not be called on a bound
+  // voice: DetachPatch() it first.
+  void BindPatch(const PatchParams *patch) { mSharedPatch = patch; }
+  const PatchParams &GetPatch() const {
+    return mSharedPatch ? *mSharedPatch : *mOwnPatch;
+  }
 
-  Voice() = default;
+  // Unbinds the voice onto block, a copy of its current patch owned by the
+  // caller (e.g. one slot of a preallocated pool), after which its patch
+  // setters apply to it alone. block must outlive the voice's use of it.
+  // Real-time safe; a later BindPatch() rebinds the voice.
+  void DetachPatch(PatchParams &block) {
+    if (&block != &GetPatch())
+      block = GetPatch();
+    mOwnPatch = &block;
+    mSharedPatch = nullptr;
+  }
+
+  // Resets the voice; a standalone voice also resets its own patch block
+  // (a shared block is reset by its owner).
+  void Init(T sampleRate, uint8_t voiceID = 0) {
+    if (!mSharedPatch)
+      EditPatch().Init(sampleRate);
+    const PatchParams &p = GetPatch();
 
-  void Init(sample_t sampleRate, uint8_t voiceID = 0) {
     mOscA.Init(sampleRate);
     mOscB.Init(sampleRate);
-    mOscA.SetFrequency(sample_t(440));
-    mDetuneFactor = sea::Math::Exp2(mDetuneB / sample_t(1200));
-    mOscB.SetFrequency(sample_t(440) * mDetuneFactor);
-    mTargetFreq = sample_t(440);
-    mGlideTime = sample_t(0);
-    mGlideAlpha = sample_t(1);
-
-    mBasePulseWidthA = sample_t(0.5);
-    mBasePulseWidthB = sample_t(0.5);
-    mOscA.SetPulseWidth(mBasePulseWidthA);
-    mOscB.SetPulseWidth(mBasePulseWidthB);
-
+    mOscA.SetFrequency(T(440));
+    mOscB.SetFrequency(T(440) * p.detuneFactor);
+    mTargetFreq = T(440);
+
+    mOscA.SetPulseWidth(p.basePulseWidthA);
+    mOscB.SetPulseWidth(p.basePulseWidthB);
+
+    if (mFilterOversampler)
+      mFilterOversampler->SetFactor(1);
+    mOversampling = 1;
+    mOversampleOscillators = false;
+    ApplyCutoffTable();
     mFilter.Init(sampleRate);
-    mFilter.SetParams(sea::FilterType::LowPass, sample_t(2000), sample_t(0.707));
+    mFilter.SetParams(sea::FilterType::LowPass, StateT(2000), StateT(0.707));
     mLadderFilter.Init(sampleRate);
     mCascadeFilter.Init(sampleRate);
 
     mAmpEnv.Init(sampleRate);
-    mAmpEnv.SetParams(sample_t(0.01), sample_t(0.1), sample_t(1), sample_t(0.2));
-
     mFilterEnv.Init(sampleRate);
-    mFilterEnv.SetParams(sample_t(0.01), sample_t(0.1), sample_t(0.5), sample_t(0.2));
 
     mLfo.Init(sampleRate);
-    mLfo.SetRate(sample_t(5));
-    mLfo.SetDepth(sample_t(0));
+    mLfo.SetRate(T(5));
+    mLfo.SetDepth(T(0));
     mLfo.SetWaveform(0);
+    mLfoBusPos = 0;
+    mLfoRetriggered = false;
 
     mActive = false;
     mNote = -1;
@@ -94,64 +146,648 @@ public:
     mCurrentPitch = 0.0f;
     mPanPosition = 0.0f;
     mStolenFadeGain = 0.0f;
-    mStolenFadeDelta = sample_t(0);
+    mStolenFadeDelta = T(0);
     mLastAmpEnvVal = 0.0f;
-    mBaseCutoff = sample_t(2000);
-    mBaseRes = sample_t(0.707);
-    mPolyModOscBToFreqA = sample_t(0);
-    mPolyModOscBToPWM = sample_t(0);
-    mPolyModOscBToFilter = sample_t(0);
-    mPolyModFilterEnvToFreqA = sample_t(0);
-    mPolyModFilterEnvToPWM = sample_t(0);
-    mPolyModFilterEnvToFilter = sample_t(0);
-    mFilterModel = FilterModel::Ladder;
+    mQuietSamples = 0;
+    mRenderedModel = p.filterModel;
+    SetControlRate(1);
   }
 
   void NoteOn(int note, int velocity, uint32_t timestamp = 0) {
-    sample_t newFreq = midiNoteToFreq(note);
+    const PatchParams &p = GetPatch();
+    T newFreq = T(midiNoteToFreq(note));
     mTargetFreq = newFreq;
 
-    if (mGlideTime > sample_t(0) && mActive) {
+    if (p.glideTime > T(0) && mActive) {
       // Legato glide: keep current frequency, glide to target
       // Don't reset oscillators — smooth transition
     } else {
       // Normal retrigger: jump to frequency immediately
       mFreq = newFreq;
       mOscA.SetFrequency(mFreq);
-      mOscB.SetFrequency(mFreq * mDetuneFactor);
+      mOscB.SetFrequency(mFreq * p.detuneFactor);
       mOscA.Reset();
       mOscB.Reset();
     }
 
-    mVelocity = velocity / sample_t(127);
+    mVelocity = velocity / T(127);
 
-    mAmpEnv.NoteOn();
-    mFilterEnv.NoteOn();
+    mAmpEnv.NoteOn(p.ampEnv);
+    mFilterEnv.NoteOn(p.filterEnv);
+    mLfoRetriggered = mLfoBus && mLfoBus->IsRetrigger();
+    if (mLfoRetriggered)
+      mLfoOffset = mLfoBus->RetriggerOffset();
     mActive = true;
     mNote = note;
     mAge = 0;
+    mControlPhase = 0;
+    mControlPrimed = false;
+    mQuietSamples = 0;
     mVoiceState = VoiceState::Attack;
     mTimestamp = timestamp;
     mCurrentPitch = static_cast<float>(mFreq);
   }
 
   void NoteOff() {
-    mAmpEnv.NoteOff();
-    mFilterEnv.NoteOff();
+    const PatchParams &p = GetPatch();
+    mAmpEnv.NoteOff(p.ampEnv);
+    mFilterEnv.NoteOff(p.filterEnv);
     mVoiceState = VoiceState::Release;
+    mQuietSamples = 0;
   }
 
-  void ApplyDetuneCents(sample_t cents) {
-    sample_t factor = sea::Math::Exp2(cents / sample_t(1200));
+  void ApplyDetuneCents(T cents) {
+    T factor = T(sea::Math::Exp2(cents / T(1200)));
     mFreq *= factor;
     mCurrentPitch = static_cast<float>(mFreq);
     mOscA.SetFrequency(mFreq);
-    mOscB.SetFrequency(mFreq * mDetuneFactor);
+    mOscB.SetFrequency(mFreq * GetPatch().detuneFactor);
+  }
+
+  inline T Process() {
+    if (!mActive)
+      return T(0);
+
+    const PatchParams &p = GetPatch();
+    const ModFlags flags = GetModFlags(p);
+    BeginRender(p, flags);
+
+    switch (p.filterModel) {
+    case FilterModel::Ladder:
+      return Tick<FilterModel::Ladder>(flags, p);
+    case FilterModel::Cascade12:
+      return Tick<FilterModel::Cascade12>(flags, p);
+    case FilterModel::Cascade24:
+      return Tick<FilterModel::Cascade24>(flags, p);
+    case FilterModel::Classic:
+    default:
+      return Tick<FilterModel::Classic>(flags, p);
+    }
+  }
+
+  // Renders nFrames mono samples into out. Produces the same samples as
+  // nFrames consecutive Process() calls (bit-identical: both paths run the
+  // same Tick<>() body), but resolves the filter-model switch and the
+  // glide/LFO/poly-mod routing checks once per block instead of per sample.
+  // Parameters must not change mid-block. Once the voice goes idle the rest
+  // of the block is zero-filled. scratch holds the envelopes pre-rendered
+  // for one chunk; it is free again when the call returns, so voices
+  // rendered one after another can share it (one per thread).
+  void ProcessBlock(T *out, int nFrames, EnvScratch &scratch) {
+    switch (GetPatch().filterModel) {
+    case FilterModel::Ladder:
+      RenderBlock<FilterModel::Ladder>(out, nFrames, scratch);
+      break;
+    case FilterModel::Cascade12:
+      RenderBlock<FilterModel::Cascade12>(out, nFrames, scratch);
+      break;
+    case FilterModel::Cascade24:
+      RenderBlock<FilterModel::Cascade24>(out, nFrames, scratch);
+      break;
+    case FilterModel::Classic:
+    default:
+      RenderBlock<FilterModel::Classic>(out, nFrames, scratch);
+      break;
+    }
+  }
+
+  // Renders nFrames of count (<= Lanes) voices whose patch uses the Ladder
+  // model, outs[l] receiving voices[l]'s mono output. The per-voice work
+  // runs as in ProcessBlock(), but the ladders of all voices are evaluated
+  // together, one sample at a time, in a sea::LadderFilterLanes, so the
+  // five tanh stages vectorise across voices. Each voice's output is
+  // bit-identical to ProcessBlock(). Every voice must pass CanBatchLadder().
+  // V is BasicVoice or a subclass (e.g. StandaloneVoice).
+  template <int Lanes, typename V>
+  static void ProcessLadderBlock(V *const *group, int count, T *const *outs,
+                                 int nFrames) {
+    static_assert(std::is_base_of_v<BasicVoice, V>, "V must be a voice");
+    BasicVoice *voices[Lanes];
+    for (int l = 0; l < count; ++l)
+      voices[l] = group[l];
+    sea::LadderFilterLanes<StateT, Lanes> ladder;
+    const PatchParams *patch[Lanes];
+    ModFlags flags[Lanes];
+    bool fixedPitch[Lanes];
+    for (int l = 0; l < count; ++l) {
+      BasicVoice &v = *voices[l];
+      patch[l] = &v.GetPatch();
+      flags[l] = GetModFlags(*patch[l]);
+      v.BeginRender(*patch[l], flags[l]);
+      fixedPitch[l] = v.HasFixedPitch(flags[l]);
+      if (fixedPitch[l]) {
+        v.mOscA.SetFrequency(v.mFreq);
+        v.mOscB.SetFrequency(v.mFreq * patch[l]->detuneFactor);
+      }
+      ladder.Load(l, v.mLadderFilter);
+      ladder.SetActive(l, v.mActive);
+    }
+
+    T oscA[Lanes][kRenderChunkSize];
+    T oscB[Lanes][kRenderChunkSize];
+    alignas(sea::simd::kAlignment) StateT in[Lanes] = {};
+    alignas(sea::simd::kAlignment) StateT flt[Lanes];
+    T lfoVal[Lanes];
+    bool live[Lanes];
+    for (int i = 0; i < nFrames;) {
+      const int n = std::min(kRenderChunkSize, nFrames - i);
+      for (int l = 0; l < count; ++l) {
+        if (fixedPitch[l] && voices[l]->mActive) {
+          voices[l]->mOscB.ProcessBlock(oscB[l], n);
+          voices[l]->mOscA.ProcessBlock(oscA[l], n);
+        }
+      }
+      for (int k = 0; k < n; ++k, ++i) {
+        for (int l = 0; l < count; ++l) {
+          BasicVoice &v = *voices[l];
+          const PatchParams &p = *patch[l];
+          TickInput ti;
+          live[l] = v.mActive &&
+                    (fixedPitch[l]
+                         ? v.TickPre<true>(flags[l], p, oscA[l] + k, oscB[l] + k, ti)
+                         : v.TickPre<false>(flags[l], p, nullptr, nullptr, ti));
+          ladder.SetActive(l, live[l]);
+          if (!live[l])
+            continue;
+          v.Filter<FilterModel::Ladder, false>(flags[l], p, ti);
+          ladder.SetCoefficients(l, v.mLadderFilter.GetCoefficients());
+          in[l] = StateT(ti.mixed);
+          lfoVal[l] = ti.lfoVal;
+        }
+        ladder.Process(in, flt);
+        for (int l = 0; l < count; ++l) {
+          outs[l][i] = live[l] ? voices[l]->TickPost(flags[l], *patch[l],
+                                                     lfoVal[l], T(flt[l]))
+                               : T(0);
+        }
+      }
+    }
+    for (int l = 0; l < count; ++l)
+      ladder.Store(l, voices[l]->mLadderFilter);
+  }
+
+  FilterModel GetFilterModel() const { return GetPatch().filterModel; }
+
+  // True when the voice can join a ProcessLadderBlock() group.
+  bool CanBatchLadder() const {
+    return GetPatch().filterModel == FilterModel::Ladder &&
+           !HasPanModulation() && mOversampling == 1;
+  }
+
+  // True when the LFO moves the pan position, i.e. pan coefficients change
+  // per sample and cannot be applied once per block.
+  bool HasPanModulation() const {
+    return GetPatch().lfoPanDepth != T(0);
+  }
+
+  bool IsActive() const { return mActive; }
+  int GetNote() const { return mNote; }
+  uint32_t GetAge() const { return mAge; }
+
+  void StartSteal() {
+    mStolenFadeGain = 1.0f;
+    // Increase fade to 20ms to prevent clicks/crunch when reducing polyphony
+    const T fadeSamples = std::max(T(1.0), T(kStolenFadeTimeSec) * mSampleRate);
+    mStolenFadeDelta = T(1.0) / fadeSamples;
+    mVoiceState = VoiceState::Stolen;
+  }
+
+  VoiceState GetVoiceState() const { return mVoiceState; }
+  uint8_t GetVoiceID() const { return mVoiceID; }
+  uint32_t GetTimestamp() const { return mTimestamp; }
+  float GetPitch() const { return mCurrentPitch; }
+  float GetOscAPhaseInc() const { return static_cast<float>(mOscA.GetPhaseIncrement()); }
+
+  float GetPanPosition() const {
+    float modulatedPan = mPanPosition + (mLastLfoVal * GetPatch().lfoPanDepth);
+    return std::clamp(modulatedPan, -1.0f, 1.0f);
+  }
+
+  void GetPanCoefficients(T &left, T &right) const {
+    left = mPanLeft;
+    right = mPanRight;
+  }
+
+  void SetPanPosition(float pan) {
+    mPanPosition = std::clamp(pan, -1.0f, 1.0f);
+    UpdatePanCache(mPanPosition);
+  }
+
+  VoiceRenderState GetRenderState() const {
+    VoiceRenderState rs;
+    rs.voiceID = mVoiceID;
+    rs.state = mVoiceState;
+    rs.note = mNote;
+    rs.velocity = static_cast<int>(mVelocity * T(127));
+    rs.currentPitch = mCurrentPitch;
+    rs.panPosition = mPanPosition;
+    rs.amplitude = mLastAmpEnvVal;
+    rs.phaseIncrement = static_cast<float>(mOscA.GetPhaseIncrement());
+    return rs;
+  }
+
+  void SetGlideTime(T seconds) { EditPatch().SetGlideTime(seconds); }
+
+  void SetADSR(T a, T d, T s, T r) {
+    EditPatch().SetADSR(a, d, s, r);
+  }
+
+  void SetFilterEnv(T a, T d, T s, T r) {
+    EditPatch().SetFilterEnv(a, d, s, r);
+  }
+
+  void SetFilter(T cutoff, T res, T envAmount) {
+    EditPatch().SetFilter(cutoff, res, envAmount);
+  }
+
+  void SetFilterModel(FilterModel model) { EditPatch().filterModel = model; }
+
+  // See PatchParams::SetReleaseCulling().
+  void SetReleaseCulling(T thresholdDb) {
+    EditPatch().SetReleaseCulling(thresholdDb);
+  }
+
+  // Filter cutoff modulation rate, in samples. 1 (default) recomputes filter
+  // coefficients whenever the cutoff moves, i.e. every sample while an
+  // envelope or LFO is running. N > 1 samples the cutoff modulation every N
+  // samples and linearly ramps the filter coefficients towards each new
+  // target, trading one control period of modulation latency for N times
+  // fewer Tan/Sin/Cos evaluations. Audio-rate cutoff modulation (poly-mod
+  // OscB → filter) always runs per sample.
+  void SetControlRate(int samples) {
+    mControlRate = std::clamp(samples, 1, kMaxControlRate);
+    mInvControlRate = StateT(1) / static_cast<StateT>(mControlRate);
+    mControlPhase = 0;
+    mControlPrimed = false;
+  }
+  int GetControlRate() const { return mControlRate; }
+
+  // Cutoff -> coefficient table shared by every filter model (nullptr, the
+  // default, computes Tan/Sin/Cos exactly). Not owned; must outlive the
+  // voice and match its sample rate. Survives Init(). Unused while the
+  // filter is oversampled (it then runs at a different rate).
+  void SetCutoffTable(const sea::CutoffTable<StateT> *table) {
+    mCutoffTable = table;
+    ApplyCutoffTable();
+  }
+
+  // Runs the filter stage at factor (1, 2 or 4) times the sample rate
+  // through a sea::Oversampler, so the ladder and cascade tanh stages alias
+  // less at high resonance. With oscillators = true the oscillators and
+  // mixer run at the higher rate too (naive waveforms alias less) and the
+  // upsampler is skipped. Costs about factor times the filter (and
+  // oscillator) CPU plus the resampling, and delays the output by
+  // GetOversamplingLatency() samples. Resets the filter state; Init()
+  // returns to 1x. Stays at 1x until BindOversampler() gives the voice
+  // resampler state.
+  void SetOversampling(int factor, bool oscillators = false) {
+    if (mFilterOversampler) {
+      mFilterOversampler->SetFactor(factor);
+      mOversampling = mFilterOversampler->GetFactor();
+    } else {
+      mOversampling = 1;
+    }
+    mOversampleOscillators = oscillators && mOversampling > 1;
+    const T filterRate = mSampleRate * T(mOversampling);
+    mFilter.Init(StateT(filterRate));
+    mFilter.SetParams(sea::FilterType::LowPass, StateT(2000), StateT(0.707));
+    mLadderFilter.Init(StateT(filterRate));
+    mCascadeFilter.Init(StateT(filterRate));
+    ApplyCutoffTable();
+    mOscA.Init(mOversampleOscillators ? filterRate : mSampleRate);
+    mOscB.Init(mOversampleOscillators ? filterRate : mSampleRate);
+    mOscA.SetFrequency(mFreq);
+    mOscB.SetFrequency(mFreq * GetPatch().detuneFactor);
+    mLastFilterCutoff = StateT(-1);
+    mControlPhase = 0;
+    mControlPrimed = false;
+  }
+  int GetOversampling() const { return mOversampling; }
+  // Resampler state for SetOversampling(), or nullptr. Not owned; one per
+  // voice, and it must outlive the voice. VoiceManager allocates them only
+  // while oversampling is on. Call SetOversampling() after rebinding.
+  void BindOversampler(sea::Oversampler<StateT> *oversampler) {
+    mFilterOversampler = oversampler;
+  }
+  bool GetOversampleOscillators() const { return mOversampleOscillators; }
+
+  // Output delay added by SetOversampling(), in samples (fractional at 4x).
+  // Oversampled oscillators skip the upsampler and its half of the delay.
+  T GetOversamplingLatency() const {
+    if (mOversampling == 1)
+      return T(0);
+    const T latency = T(mFilterOversampler->GetLatency());
+    return mOversampleOscillators ? latency * T(0.5) : latency;
+  }
+
+  void SetWaveform(sea::Oscillator::WaveformType type) { SetWaveformA(type); }
+  void SetWaveformA(sea::Oscillator::WaveformType type) {
+    mOscA.SetWaveform(type);
+  }
+  void SetWaveformB(sea::Oscillator::WaveformType type) {
+    mOscB.SetWaveform(type);
+  }
+
+  // Naive or PolyBLEP band-limited waveforms, per oscillator.
+  void SetAntialiasA(sea::OscillatorAntialias mode) { mOscA.SetAntialias(mode); }
+  void SetAntialiasB(sea::OscillatorAntialias mode) { mOscB.SetAntialias(mode); }
+
+  void SetPulseWidth(T pw) { SetPulseWidthA(pw); }
+  void SetPulseWidthA(T pw) { EditPatch().SetPulseWidthA(pw); }
+  void SetPulseWidthB(T pw) { EditPatch().SetPulseWidthB(pw); }
+
+  void SetMixer(T mixA, T mixB, T detuneB) {
+    EditPatch().SetMixer(mixA, mixB, detuneB);
+  }
+
+  // Reads the LFO from a shared bus instead of running the voice's own (see
+  // BasicLfoBus); nullptr, the default, returns to the own LFO. Not owned.
+  // Survives Init(). The owner renders the bus and calls RewindLfoBus()
+  // before each block.
+  void BindLfoBus(const LfoBus *bus) { mLfoBus = bus; }
+  void RewindLfoBus() { mLfoBusPos = 0; }
+
+  void SetLFO(int type, T rate, T depth) {
+    mLfo.SetWaveform(type);
+    mLfo.SetRate(rate);
+    mLfo.SetDepth(depth);
+  }
+
+  void SetLFORouting(T pitch, T filter, T amp,
+                     T pan = T(0)) {
+    EditPatch().SetLFORouting(pitch, filter, amp, pan);
+  }
+
+  void SetPolyModOscBToFreqA(T amount) {
+    EditPatch().polyModOscBToFreqA = amount;
+  }
+  void SetPolyModOscBToPWM(T amount) {
+    EditPatch().polyModOscBToPWM = amount;
+  }
+  void SetPolyModOscBToFilter(T amount) {
+    EditPatch().polyModOscBToFilter = amount;
+  }
+  void SetPolyModFilterEnvToFreqA(T amount) {
+    EditPatch().polyModFilterEnvToFreqA = amount;
+  }
+  void SetPolyModFilterEnvToPWM(T amount) {
+    EditPatch().polyModFilterEnvToPWM = amount;
+  }
+  void SetPolyModFilterEnvToFilter(T amount) {
+    EditPatch().polyModFilterEnvToFilter = amount;
+  }
+
+protected:
+  // Points the voice at the block its patch setters edit, without touching
+  // a shared binding (storage for owning subclasses).
+  void SetOwnPatch(PatchParams *block) { mOwnPatch = block; }
+
+private:
+  // Gathers the per-sample state of a group of voices into its lane
+  // arrays and scatters it back (see VoiceBank.h).
+  template <typename, typename, int> friend class BasicVoiceBank;
+
+  // Routing decisions that depend only on patch parameters. Process()
+  // evaluates them per call; ProcessBlock() once per block.
+  struct ModFlags {
+    bool lfo;
+    bool lfoPitch;
+    bool lfoAmp;
+    bool lfoPan;
+    bool glide;
+    bool polyModFreqA;
+    bool polyModPWM;
+    bool polyModFilter;
+  };
+
+  static ModFlags GetModFlags(const PatchParams &p) {
+    ModFlags f;
+    f.lfo = p.HasLfoRouting();
+    f.lfoPitch = p.lfoPitchDepth > T(0);
+    f.lfoAmp = p.lfoAmpDepth > T(0);
+    f.lfoPan = p.lfoPanDepth != T(0);
+    f.glide = p.glideTime > T(0);
+    f.polyModFreqA = p.polyModOscBToFreqA != T(0) ||
+                     p.polyModFilterEnvToFreqA != T(0);
+    f.polyModPWM = p.polyModOscBToPWM != T(0) ||
+                   p.polyModFilterEnvToPWM != T(0);
+    f.polyModFilter = p.polyModOscBToFilter != T(0);
+    return f;
+  }
+
+  // Applies the patch state the oscillators/filters cache per voice. A
+  // filter model change restarts the control-rate coefficient ramp.
+  SEA_INLINE void BeginRender(const PatchParams &p, const ModFlags &flags) {
+    if (!flags.polyModPWM)
+      mOscA.SetPulseWidth(p.basePulseWidthA);
+    mOscB.SetPulseWidth(p.basePulseWidthB);
+    if (p.filterModel != mRenderedModel) {
+      mRenderedModel = p.filterModel;
+      mControlPrimed = false;
+    }
+  }
+
+  template <FilterModel Model>
+  void RenderBlock(T *out, int nFrames, EnvScratch &scratch) {
+    int i = 0;
+    if (mActive) {
+      const PatchParams &p = GetPatch();
+      const ModFlags flags = GetModFlags(p);
+      BeginRender(p, flags);
+      if (HasFixedPitch(flags)) {
+        // Nothing moves the oscillator frequencies or pulse width within
+        // the block, so render both with the oscillator block kernels first.
+        // If the voice dies mid-block the oscillators have run ahead, which
+        // is harmless: the next NoteOn on an idle voice resets their phase.
+        // Oversampled oscillators render oscFactor samples per output
+        // sample, so a chunk then covers fewer output samples.
+        mOscA.SetFrequency(mFreq);
+        mOscB.SetFrequency(mFreq * p.detuneFactor);
+        const int oscFactor = GetOscillatorFactor();
+        T oscA[kRenderChunkSize];
+        T oscB[kRenderChunkSize];
+        while (i < nFrames && mActive) {
+          const int n = std::min(kRenderChunkSize / oscFactor, nFrames - i);
+          mOscB.ProcessBlock(oscB, n * oscFactor);
+          mOscA.ProcessBlock(oscA, n * oscFactor);
+          PrefillEnvelopes(p, n, scratch);
+          for (int k = 0; k < n && mActive;) {
+            const T *a = oscA + k * oscFactor;
+            const T *b = oscB + k * oscFactor;
+            if (HasBlockFilter(flags)) {
+              const int m = RenderFilterSegment<Model, true>(flags, p, a, b,
+                                                             out + i, n - k);
+              k += m;
+              i += m;
+            } else {
+              out[i++] = Tick<Model, true>(flags, p, a, b);
+              ++k;
+            }
+          }
+          mEnvBlockLen = 0;
+        }
+      } else {
+        while (i < nFrames && mActive) {
+          const int end = i + std::min(kRenderChunkSize, nFrames - i);
+          PrefillEnvelopes(p, end - i, scratch);
+          while (i < end && mActive) {
+            if (HasBlockFilter(flags)) {
+              i += RenderFilterSegment<Model, false>(flags, p, nullptr,
+                                                     nullptr, out + i, end - i);
+            } else {
+              out[i++] = Tick<Model>(flags, p);
+            }
+          }
+          mEnvBlockLen = 0;
+        }
+      }
+    }
+    for (; i < nFrames; ++i)
+      out[i] = T(0);
+  }
+
+  int GetOscillatorFactor() const {
+    return mOversampleOscillators ? mOversampling : 1;
+  }
+
+  void ApplyCutoffTable() {
+    const sea::CutoffTable<StateT> *table =
+        mOversampling == 1 ? mCutoffTable : nullptr;
+    mFilter.SetCutoffTable(table);
+    mLadderFilter.SetCutoffTable(table);
+    mCascadeFilter.SetCutoffTable(table);
+  }
+
+  // With the gate held neither envelope can reach idle, so the voice cannot
+  // retire mid-chunk and both envelopes can render the next n samples up
+  // front with their segment-based ProcessBlock(). TickPre()/TickPost()
+  // then read the values in order (NextFilterEnv()/NextAmpEnv()) instead of
+  // calling Process(); any other state leaves them per-sample.
+  void PrefillEnvelopes(const PatchParams &p, int n, EnvScratch &scratch) {
+    mEnvBlockPos[0] = 0;
+    mEnvBlockPos[1] = 0;
+    mEnvBlockLen = 0;
+    if (mVoiceState != VoiceState::Attack)
+      return;
+    mFilterEnv.ProcessBlock(p.filterEnv, scratch.filterEnv, n);
+    mAmpEnv.ProcessBlock(p.ampEnv, scratch.ampEnv, n);
+    mEnvBlock = &scratch;
+    mEnvBlockLen = n;
+  }
+
+  SEA_INLINE T NextFilterEnv(const PatchParams &p) {
+    if (mEnvBlockPos[0] < mEnvBlockLen)
+      return mEnvBlock->filterEnv[mEnvBlockPos[0]++];
+    return mFilterEnv.Process(p.filterEnv);
+  }
+
+  SEA_INLINE T NextAmpEnv(const PatchParams &p) {
+    if (mEnvBlockPos[1] < mEnvBlockLen)
+      return mEnvBlock->ampEnv[mEnvBlockPos[1]++];
+    return mAmpEnv.Process(p.ampEnv);
+  }
+
+  // Next LFO sample: the bus value for this block position when bound (the
+  // voice's own rotation of it after a retrigger), else the own LFO. The bus
+  // owner must have rendered at least as many values as the voice renders.
+  SEA_INLINE T NextLfo() {
+    if (!mLfoBus)
+      return mLfo.Process();
+    const int k = mLfoBusPos;
+    assert(k < mLfoBus->GetLength() && "LFO bus not rendered for this block");
+    ++mLfoBusPos;
+    if (mLfoRetriggered && mLfoBus->IsRetrigger())
+      return mLfoBus->Rotated(k, mLfoOffset);
+    return mLfoBus->Value(k);
+  }
+
+  // True when the control-rate filter can run a whole control period
+  // through the filters' ProcessBlock(). Requires a held gate: neither
+  // envelope can finish, so the voice cannot retire mid-segment and leave
+  // the filter, LFO or filter envelope run ahead of the per-sample path.
+  SEA_INLINE bool HasBlockFilter(const ModFlags &flags) const {
+    return mControlRate > 1 && !flags.polyModFilter &&
+           mVoiceState == VoiceState::Attack;
+  }
+
+  // Renders up to maxFrames samples, stopping at the next control point:
+  // steps 1-8 for every sample, then the filter over the whole segment in
+  // one ProcessBlock() call on the current coefficient ramp, then steps
+  // 9-11. Bit-identical to the same number of Tick() calls. Returns the
+  // number of samples rendered. Caller guarantees HasBlockFilter(). With
+  // kBlockOsc, oscA/oscB hold GetOscillatorFactor() samples per output
+  // sample.
+  template <FilterModel Model, bool kBlockOsc>
+  int RenderFilterSegment(const ModFlags &flags, const PatchParams &p,
+                          const T *oscA, const T *oscB, T *out,
+                          int maxFrames) {
+    const int factor = mOversampling;
+    const int oscFactor = GetOscillatorFactor();
+    const int n = std::min({maxFrames, mControlRate - mControlPhase,
+                            kRenderChunkSize / factor});
+    StateT mixed[kRenderChunkSize];
+    StateT flt[kRenderChunkSize];
+    T lfoVal[kRenderChunkSize];
+    StateT cutoff = StateT(0);
+    for (int k = 0; k < n; ++k) {
+      TickInput ti{};
+      TickPre<kBlockOsc>(flags, p, kBlockOsc ? oscA + k * oscFactor : nullptr,
+                         kBlockOsc ? oscB + k * oscFactor : nullptr, ti);
+      if (k == 0)
+        cutoff = StateT(ti.cutoff);
+      if (oscFactor > 1) {
+        for (int j = 0; j < oscFactor; ++j)
+          mixed[k * oscFactor + j] = StateT(ti.mixedUp[j]);
+      } else {
+        mixed[k] = StateT(ti.mixed);
+      }
+      lfoVal[k] = ti.lfoVal;
+    }
+    if (factor == 1) {
+      ControlRateFilterBlock<Model>(mixed, flt, n, cutoff, StateT(p.baseRes));
+    } else {
+      // The filter runs on factor samples per output sample.
+      StateT up[kRenderChunkSize];
+      if (oscFactor > 1)
+        std::copy(mixed, mixed + n * factor, up);
+      else
+        mFilterOversampler->Upsample(mixed, up, n);
+      ControlRateFilterBlock<Model>(up, up, n, cutoff, StateT(p.baseRes));
+      mFilterOversampler->Downsample(up, flt, n);
+    }
+    for (int k = 0; k < n; ++k)
+      out[k] = TickPost(flags, p, lfoVal[k], T(flt[k]));
+    return n;
+  }
+
+  // True when the oscillator frequencies and pulse widths are constant for
+  // the whole block: no vibrato, no poly-mod of pitch/PWM, no glide still
+  // converging (the glide target only changes on NoteOn, between blocks).
+  SEA_INLINE bool HasFixedPitch(const ModFlags &flags) const {
+    return !flags.lfoPitch && !flags.polyModFreqA && !flags.polyModPWM &&
+           (!flags.glide ||
+            !(std::abs(mFreq - mTargetFreq) > T(kGlideSnapThresholdHz)));
   }
 
-  inline sample_t Process() {
+  // Per-sample values handed from the pre-filter half of Tick() to the
+  // filter and the post-filter half.
+  struct TickInput {
+    T lfoVal;
+    T mixed;
+    T cutoff;
+    T mixedUp[kMaxOversampling]; // mixer at the oscillator rate (oscFactor > 1)
+  };
+
+  // One sample of an active voice. Caller guarantees mActive and has run
+  // BeginRender() for the current patch. With kBlockOsc the oscillator
+  // samples come pre-rendered (see RenderBlock), GetOscillatorFactor() per
+  // output sample, instead of being generated here.
+  template <FilterModel Model, bool kBlockOsc = false>
+  SEA_INLINE T Tick(const ModFlags &flags, const PatchParams &p,
+                    const T *blockOscA = nullptr,
+                    const T *blockOscB = nullptr) {
     // ─── Voice Signal Flow ────────────────────────────────────────────
-    // 1. Early exit if voice is idle or stolen-and-faded
+    // 1. Early exit if voice is stolen-and-faded
     // 2. LFO + Filter Envelope generation
     // 3. Portamento: exponential glide toward target frequency
     // 4. Pitch modulation: base freq ← LFO vibrato + poly-mod (OscB→FreqA, FilterEnv→FreqA)
@@ -160,35 +796,45 @@ public:
     // 7. Mixer: OscA × mixA + OscB × mixB
     // 8. Filter: base cutoff + filter env + poly-mod + LFO modulation
     // 9. Amp envelope × velocity × tremolo (LFO amp mod)
-    // 10. Voice stealing fade (if state == Stolen)
+    // 10. Release-tail culling (if enabled and state == Release)
+    // 11. Voice stealing fade (if state == Stolen)
     // ──────────────────────────────────────────────────────────────────
 
-    // ── Step 1: Early exit ──
-    if (!mActive)
-      return sample_t(0);
+    TickInput ti;
+    if (!TickPre<kBlockOsc>(flags, p, blockOscA, blockOscB, ti))
+      return T(0);
+    const T flt = T(Filter<Model>(flags, p, ti));
+    return TickPost(flags, p, ti.lfoVal, flt);
+  }
 
+  // Steps 1-8 up to the filter cutoff. False if the voice just finished its
+  // steal fade (it is now idle and outputs 0).
+  template <bool kBlockOsc>
+  SEA_INLINE bool TickPre(const ModFlags &flags, const PatchParams &p,
+                          const T *blockOscA, const T *blockOscB,
+                          TickInput &ti) {
+    // ── Step 1: Early exit ──
     if (mVoiceState == VoiceState::Stolen && mStolenFadeGain <= 0.0f) {
       mActive = false;
       mNote = -1;
       mVoiceState = VoiceState::Idle;
       mAge = 0;
       mLastAmpEnvVal = 0.0f;
-      return sample_t(0);
+      return false;
     }
 
     // ── Step 2: LFO & Filter Envelope ──
-    sample_t lfoVal = sample_t(0);
-    if (mLfoPitchDepth != sample_t(0) || mLfoFilterDepth != sample_t(0) ||
-        mLfoAmpDepth != sample_t(0) || mLfoPanDepth != sample_t(0)) {
-      lfoVal = mLfo.Process();
+    T lfoVal = T(0);
+    if (flags.lfo) {
+      lfoVal = NextLfo();
     }
-    sample_t filterEnvVal = mFilterEnv.Process();
+    T filterEnvVal = NextFilterEnv(p);
 
     // ── Step 3: Portamento ──
-    if (mGlideTime > sample_t(0) && std::abs(mFreq - mTargetFreq) > kGlideSnapThresholdHz) {
-      mFreq += (mTargetFreq - mFreq) * mGlideAlpha;
+    if (flags.glide && std::abs(mFreq - mTargetFreq) > T(kGlideSnapThresholdHz)) {
+      mFreq += (mTargetFreq - mFreq) * p.glideAlpha;
       // Snap to target when close enough
-      if (std::abs(mFreq - mTargetFreq) < kGlideSnapThresholdHz) {
+      if (std::abs(mFreq - mTargetFreq) < T(kGlideSnapThresholdHz)) {
         mFreq = mTargetFreq;
       }
       mCurrentPitch = static_cast<float>(mFreq);
@@ -198,96 +844,143 @@ public:
     }
 
     // ── Step 4-6: Oscillator Synthesis & Modulation ──
-    sample_t modFreqA = mFreq;
-    sample_t modFreqB = mFreq * mDetuneFactor;
+    // Oversampled oscillators produce oscFactor samples per output sample;
+    // modulation reads the first of them.
+    const int oscFactor = GetOscillatorFactor();
+    const T *oscAUp = blockOscA;
+    const T *oscBUp = blockOscB;
+    T subA[kMaxOversampling];
+    T subB[kMaxOversampling];
+    T oscA = T(0);
+    T oscB = T(0);
+    if constexpr (kBlockOsc) {
+      oscA = blockOscA[0];
+      oscB = blockOscB[0];
+    } else {
+      T modFreqA = mFreq;
+      T modFreqB = mFreq * p.detuneFactor;
 
-    if (mLfoPitchDepth > sample_t(0)) {
-      sample_t modMult = (sample_t(1) + lfoVal * mLfoPitchDepth * kLfoPitchScale);
-      modFreqA *= modMult;
-      modFreqB *= modMult;
-    }
+      if (flags.lfoPitch) {
+        T modMult = (T(1) + lfoVal * p.lfoPitchDepth * T(kLfoPitchScale));
+        modFreqA *= modMult;
+        modFreqB *= modMult;
+      }
 
-    mOscB.SetFrequency(modFreqB);
-    sample_t oscB = mOscB.Process();
+      mOscB.SetFrequency(modFreqB);
+      oscB = mOscB.Process();
 
-    if (mPolyModOscBToFreqA != sample_t(0) || mPolyModFilterEnvToFreqA != sample_t(0)) {
-      sample_t freqMod = (oscB * mPolyModOscBToFreqA) +
-                         (filterEnvVal * mPolyModFilterEnvToFreqA);
-      modFreqA *= (sample_t(1) + freqMod);
-      modFreqA = std::max(sample_t(1), modFreqA);
-    }
+      if (flags.polyModFreqA) {
+        T freqMod = (oscB * p.polyModOscBToFreqA) +
+                           (filterEnvVal * p.polyModFilterEnvToFreqA);
+        modFreqA *= (T(1) + freqMod);
+        modFreqA = std::max(T(1), modFreqA);
+      }
 
-    mOscA.SetFrequency(modFreqA);
+      mOscA.SetFrequency(modFreqA);
 
-    if (mPolyModOscBToPWM != sample_t(0) || mPolyModFilterEnvToPWM != sample_t(0)) {
-      sample_t pwmMod =
-          (oscB * mPolyModOscBToPWM) + (filterEnvVal * mPolyModFilterEnvToPWM);
-      sample_t pwmA = mBasePulseWidthA + (pwmMod * kPwmModScale);
-      mOscA.SetPulseWidth(std::clamp(pwmA, sample_t(0.01), sample_t(0.99)));
-    } else {
-      mOscA.SetPulseWidth(mBasePulseWidthA);
-    }
+      if (flags.polyModPWM) {
+        T pwmMod =
+            (oscB * p.polyModOscBToPWM) + (filterEnvVal * p.polyModFilterEnvToPWM);
+        T pwmA = p.basePulseWidthA + (pwmMod * T(kPwmModScale));
+        mOscA.SetPulseWidth(std::clamp(pwmA, T(0.01), T(0.99)));
+      }
 
-    sample_t oscA = mOscA.Process();
+      oscA = mOscA.Process();
+      if (oscFactor > 1) {
+        subA[0] = oscA;
+        subB[0] = oscB;
+        for (int j = 1; j < oscFactor; ++j) {
+          subB[j] = mOscB.Process();
+          subA[j] = mOscA.Process();
+        }
+        oscAUp = subA;
+        oscBUp = subB;
+      }
+    }
     // ── Step 7: Mixer ──
-    sample_t mixed = (oscA * mMixA) + (oscB * mMixB);
+    T mixed = (oscA * p.mixA) + (oscB * p.mixB);
+    if (oscFactor > 1) {
+      for (int j = 0; j < oscFactor; ++j)
+        ti.mixedUp[j] = (oscAUp[j] * p.mixA) + (oscBUp[j] * p.mixB);
+    }
 
-    // ── Step 8: Filter (model dispatch) ──
-    sample_t cutoff = mBaseCutoff;
+    // ── Step 8: Filter cutoff ──
+    T cutoff = p.baseCutoff;
     cutoff +=
-        filterEnvVal * (mFilterEnvAmount + mPolyModFilterEnvToFilter) * kFilterEnvMaxHz;
-    if (mPolyModOscBToFilter != sample_t(0)) {
-      cutoff += oscB * mPolyModOscBToFilter * mBaseCutoff;
+        filterEnvVal * (p.filterEnvAmount + p.polyModFilterEnvToFilter) * T(kFilterEnvMaxHz);
+    if (flags.polyModFilter) {
+      cutoff += oscB * p.polyModOscBToFilter * p.baseCutoff;
     }
-    cutoff *= (sample_t(1) + lfoVal * mLfoFilterDepth);
-    cutoff = std::clamp(cutoff, sample_t(20.0), sample_t(20000.0));
-
-    sample_t flt = sample_t(0);
-    bool filterDirty = (cutoff != mLastFilterCutoff || mBaseRes != mLastFilterRes);
-    if (filterDirty) {
-      mLastFilterCutoff = cutoff;
-      mLastFilterRes = mBaseRes;
+    cutoff *= (T(1) + lfoVal * p.lfoFilterDepth);
+    cutoff = std::clamp(cutoff, T(20.0), T(20000.0));
+
+    ti.lfoVal = lfoVal;
+    ti.mixed = mixed;
+    ti.cutoff = cutoff;
+    return true;
+  }
+
+  // Step 8 filter (model resolved at compile time). kRun = false only
+  // updates the ladder coefficients for ProcessLadderBlock().
+  template <FilterModel Model, bool kRun = true>
+  SEA_INLINE StateT Filter(const ModFlags &flags, const PatchParams &p,
+                           const TickInput &ti) {
+    if (mOversampling > 1)
+      return OversampledFilter<Model>(flags, p, ti);
+    if (mControlRate > 1 && !flags.polyModFilter)
+      return ControlRateFilter<Model, kRun>(StateT(ti.mixed), StateT(ti.cutoff),
+                                            StateT(p.baseRes));
+    return AudioRateFilter<Model, kRun>(StateT(ti.mixed), StateT(ti.cutoff),
+                                        StateT(p.baseRes));
+  }
+
+  // Filter() at mOversampling samples per output sample: the mixer output
+  // is upsampled (or taken from the oversampled oscillators), filtered at
+  // the higher rate and band-limited back down.
+  template <FilterModel Model>
+  SEA_INLINE StateT OversampledFilter(const ModFlags &flags,
+                                      const PatchParams &p,
+                                      const TickInput &ti) {
+    const int factor = mOversampling;
+    StateT x[kMaxOversampling];
+    if (GetOscillatorFactor() > 1) {
+      for (int j = 0; j < factor; ++j)
+        x[j] = StateT(ti.mixedUp[j]);
+    } else {
+      const StateT in = StateT(ti.mixed);
+      mFilterOversampler->Upsample(&in, x, 1);
     }
-    switch (mFilterModel) {
-    case FilterModel::Ladder:
-      if (filterDirty)
-        mLadderFilter.SetParams(sea::LadderFilter<sample_t>::Model::Transistor,
-                                cutoff, mBaseRes);
-      flt = mLadderFilter.Process(mixed);
-      break;
-    case FilterModel::Cascade12:
-      if (filterDirty)
-        mCascadeFilter.SetParams(cutoff, mBaseRes,
-                                 sea::CascadeFilter<sample_t>::Slope::dB12);
-      flt = mCascadeFilter.Process(mixed);
-      break;
-    case FilterModel::Cascade24:
-      if (filterDirty)
-        mCascadeFilter.SetParams(cutoff, mBaseRes,
-                                 sea::CascadeFilter<sample_t>::Slope::dB24);
-      flt = mCascadeFilter.Process(mixed);
-      break;
-    case FilterModel::Classic:
-    default:
-      if (filterDirty)
-        mFilter.SetParams(sea::FilterType::LowPass, cutoff, mBaseRes);
-      flt = mFilter.Process(mixed);
-      break;
+    const StateT cutoff = StateT(ti.cutoff);
+    const StateT res = StateT(p.baseRes);
+    if (mControlRate > 1 && !flags.polyModFilter) {
+      ControlRateFilterBlock<Model>(x, x, 1, cutoff, res);
+    } else {
+      mControlPrimed = false;
+      SetFilterParams<Model>(cutoff, res);
+      for (int j = 0; j < factor; ++j)
+        x[j] = FilterSample<Model>(x[j]);
     }
+    StateT out;
+    mFilterOversampler->Downsample(x, &out, 1);
+    return out;
+  }
 
+  // Steps 9-11 on the filter output.
+  SEA_INLINE T TickPost(const ModFlags &flags, const PatchParams &p, T lfoVal,
+                        T flt) {
     // ── Step 9: Amplitude Envelope & Tremolo ──
-    sample_t ampEnvVal = mAmpEnv.Process();
+    T ampEnvVal = NextAmpEnv(p);
     mLastAmpEnvVal = static_cast<float>(ampEnvVal);
-    sample_t ampMod = sample_t(1);
-    if (mLfoAmpDepth > sample_t(0)) {
-      ampMod = sample_t(1) + lfoVal * mLfoAmpDepth;
-      ampMod = std::clamp(ampMod, sample_t(0.0), sample_t(2.0));
+    T ampMod = T(1);
+    if (flags.lfoAmp) {
+      ampMod = T(1) + lfoVal * p.lfoAmpDepth;
+      ampMod = std::clamp(ampMod, T(0.0), T(2.0));
     }
 
     // Update pan cache with LFO modulation (only recomputes sin/cos if pan changed)
     mLastLfoVal = static_cast<float>(lfoVal);
-    if (mLfoPanDepth != sample_t(0)) {
-      float modulatedPan = mPanPosition + (mLastLfoVal * mLfoPanDepth);
+    if (flags.lfoPan) {
+      float modulatedPan = mPanPosition + (mLastLfoVal * p.lfoPanDepth);
       modulatedPan = std::clamp(modulatedPan, -1.0f, 1.0f);
       UpdatePanCache(modulatedPan);
     }
@@ -301,8 +994,11 @@ public:
       mVoiceState = VoiceState::Idle;
     }
 
-    sample_t out = flt * ampEnvVal * mVelocity * ampMod;
-    // ── Step 10: Voice Stealing Fade ──
+    T out = flt * ampEnvVal * mVelocity * ampMod;
+    // ── Step 10: Release-Tail Culling ──
+    if (p.cullThreshold > T(0) && mVoiceState == VoiceState::Release)
+      CullIfSilent(out, p);
+    // ── Step 11: Voice Stealing Fade ──
     if (mVoiceState == VoiceState::Stolen) {
       const float gain = std::max(0.0f, mStolenFadeGain);
       out *= gain;
@@ -319,180 +1015,222 @@ public:
     return out;
   }
 
-  bool IsActive() const { return mActive; }
-  int GetNote() const { return mNote; }
-  uint32_t GetAge() const { return mAge; }
-
-  void StartSteal() {
-    mStolenFadeGain = 1.0f;
-    // Increase fade to 20ms to prevent clicks/crunch when reducing polyphony
-    const sample_t fadeSamples = std::max(sample_t(1.0), kStolenFadeTimeSec * mSampleRate);
-    mStolenFadeDelta = sample_t(1.0) / fadeSamples;
-    mVoiceState = VoiceState::Stolen;
-  }
-
-  VoiceState GetVoiceState() const { return mVoiceState; }
-  uint8_t GetVoiceID() const { return mVoiceID; }
-  uint32_t GetTimestamp() const { return mTimestamp; }
-  float GetPitch() const { return mCurrentPitch; }
-  float GetOscAPhaseInc() const { return static_cast<float>(mOscA.GetPhaseIncrement()); }
-
-  float GetPanPosition() const {
-    float modulatedPan = mPanPosition + (mLastLfoVal * mLfoPanDepth);
-    return std::clamp(modulatedPan, -1.0f, 1.0f);
-  }
-
-  void GetPanCoefficients(sample_t &left, sample_t &right) const {
-    left = mPanLeft;
-    right = mPanRight;
-  }
-
-  void SetPanPosition(float pan) {
-    mPanPosition = std::clamp(pan, -1.0f, 1.0f);
-    UpdatePanCache(mPanPosition);
+  // Retires a releasing voice once its post-envelope output has stayed below
+  // the culling threshold for cullHoldSamples in a row. Any louder sample
+  // restarts the count, so a resonant tail swinging back above the threshold
+  // is never cut mid-cycle; the final step to silence is below threshold.
+  // Both envelopes are reset too, so the next NoteOn attacks from zero
+  // rather than from the residual release level.
+  SEA_INLINE void CullIfSilent(T out, const PatchParams &p) {
+    if (std::abs(out) >= p.cullThreshold) {
+      mQuietSamples = 0;
+      return;
+    }
+    if (++mQuietSamples >= p.cullHoldSamples) {
+      mActive = false;
+      mNote = -1;
+      mVoiceState = VoiceState::Idle;
+      mAge = 0;
+      mLastAmpEnvVal = 0.0f;
+      mAmpEnv.Reset();
+      mFilterEnv.Reset();
+    }
   }
 
-  VoiceRenderState GetRenderState() const {
-    VoiceRenderState rs;
-    rs.voiceID = mVoiceID;
-    rs.state = mVoiceState;
-    rs.note = mNote;
-    rs.velocity = static_cast<int>(mVelocity * sample_t(127));
-    rs.currentPitch = mCurrentPitch;
-    rs.panPosition = mPanPosition;
-    rs.amplitude = mLastAmpEnvVal;
-    rs.phaseIncrement = static_cast<float>(mOscA.GetPhaseIncrement());
-    return rs;
+  // Per-sample filter path: coefficients recomputed whenever cutoff or
+  // resonance changed since the previous sample.
+  template <FilterModel Model, bool kRun = true>
+  SEA_INLINE StateT AudioRateFilter(StateT in, StateT cutoff, StateT res) {
+    mControlPrimed = false;
+    SetFilterParams<Model>(cutoff, res);
+    if constexpr (!kRun)
+      return StateT(0);
+    return FilterSample<Model>(in);
   }
 
-  void SetGlideTime(sample_t seconds) {
-    mGlideTime = std::max(sample_t(0.0), seconds);
-    if (mGlideTime > sample_t(0)) {
-      mGlideAlpha = sample_t(1) - std::exp(-kGlideTimeConstant / (mGlideTime * mSampleRate));
+  template <FilterModel Model>
+  SEA_INLINE void SetFilterParams(StateT cutoff, StateT res) {
+    if (cutoff == mLastFilterCutoff && res == mLastFilterRes)
+      return;
+    mLastFilterCutoff = cutoff;
+    mLastFilterRes = res;
+    if constexpr (Model == FilterModel::Ladder) {
+      mLadderFilter.SetParams(sea::LadderFilter<StateT>::Model::Transistor,
+                              cutoff, res);
+    } else if constexpr (Model == FilterModel::Cascade12 ||
+                         Model == FilterModel::Cascade24) {
+      mCascadeFilter.SetParams(cutoff, res, CascadeSlope<Model>());
     } else {
-      mGlideAlpha = sample_t(1); // Instant snap
+      mFilter.SetParams(sea::FilterType::LowPass, cutoff, res);
     }
   }
 
-  void SetADSR(sample_t a, sample_t d, sample_t s, sample_t r) {
-    mAmpEnv.SetParams(a, d, s, r);
-  }
-
-  void SetFilterEnv(sample_t a, sample_t d, sample_t s, sample_t r) {
-    mFilterEnv.SetParams(a, d, s, r);
-  }
-
-  void SetFilter(sample_t cutoff, sample_t res, sample_t envAmount) {
-    mBaseCutoff = cutoff;
-    // Map 0-1 resonance to 0.5-20.5 Q for the biquad filter
-    mBaseRes = kResonanceBaseQ + (res * res * kResonanceScale);
-    mFilterEnvAmount = envAmount;
-  }
-
-  void SetFilterModel(FilterModel model) { mFilterModel = model; }
-
-  void SetWaveform(sea::Oscillator::WaveformType type) { SetWaveformA(type); }
-  void SetWaveformA(sea::Oscillator::WaveformType type) {
-    mOscA.SetWaveform(type);
-  }
-  void SetWaveformB(sea::Oscillator::WaveformType type) {
-    mOscB.SetWaveform(type);
-  }
-
-  void SetPulseWidth(sample_t pw) { SetPulseWidthA(pw); }
-  void SetPulseWidthA(sample_t pw) {
-    mBasePulseWidthA = std::clamp(pw, sample_t(0.01), sample_t(0.99));
-    mOscA.SetPulseWidth(mBasePulseWidthA);
-  }
-  void SetPulseWidthB(sample_t pw) {
-    mBasePulseWidthB = std::clamp(pw, sample_t(0.01), sample_t(0.99));
-    mOscB.SetPulseWidth(mBasePulseWidthB);
+  template <FilterModel Model> SEA_INLINE StateT FilterSample(StateT in) {
+    if constexpr (Model == FilterModel::Ladder)
+      return mLadderFilter.Process(in);
+    else if constexpr (Model == FilterModel::Cascade12 ||
+                       Model == FilterModel::Cascade24)
+      return mCascadeFilter.Process(in);
+    else
+      return mFilter.Process(in);
   }
 
-  void SetMixer(sample_t mixA, sample_t mixB, sample_t detuneB) {
-    mMixA = std::clamp(mixA, sample_t(0.0), sample_t(1.0));
-    mMixB = std::clamp(mixB, sample_t(0.0), sample_t(1.0));
-    mDetuneB = detuneB;
-    mDetuneFactor = sea::Math::Exp2(mDetuneB / sample_t(1200));
+  // Control-rate filter path: the cutoff is sampled every mControlRate
+  // samples and the coefficients ramp linearly across the following control
+  // period towards the cutoff extrapolated to its end. Envelopes are
+  // piecewise linear, so the extrapolation removes the one-period lag a
+  // plain "ramp to the last sample" scheme would add.
+  template <FilterModel Model, bool kRun = true>
+  SEA_INLINE StateT ControlRateFilter(StateT in, StateT cutoff, StateT res) {
+    if (mControlPhase == 0)
+      BeginControlPeriod<Model>(cutoff, res);
+    ++mControlPhase;
+    const StateT t = static_cast<StateT>(mControlPhase) * mInvControlRate;
+    if (mControlPhase >= mControlRate)
+      mControlPhase = 0;
+    mControlPrimed = true;
+
+    if constexpr (Model == FilterModel::Ladder) {
+      mLadderFilter.SetCoefficients(LadderCoeffs::Lerp(mLadderFrom, mLadderTo, t));
+      if constexpr (!kRun)
+        return StateT(0);
+      return mLadderFilter.Process(in);
+    } else if constexpr (Model == FilterModel::Cascade12 ||
+                         Model == FilterModel::Cascade24) {
+      mCascadeFilter.SetCoefficients(
+          CascadeCoeffs::Lerp(mCascadeFrom, mCascadeTo, t), CascadeSlope<Model>());
+      return mCascadeFilter.Process(in);
+    } else {
+      mFilter.SetCoefficients(BiquadCoeffs::Lerp(mBiquadFrom, mBiquadTo, t));
+      return mFilter.Process(in);
+    }
   }
 
-  void SetLFO(int type, sample_t rate, sample_t depth) {
-    mLfo.SetWaveform(type);
-    mLfo.SetRate(rate);
-    mLfo.SetDepth(depth);
+  // ControlRateFilter() over n samples that do not cross a control point
+  // (cutoff is only read when the first of them is one). The filters'
+  // ProcessBlock() applies the same Lerp(from, to, phase / rate) sequence.
+  // in/out hold mOversampling filter-rate samples per output sample, and
+  // the ramp then advances in filter-rate steps.
+  template <FilterModel Model>
+  SEA_INLINE void ControlRateFilterBlock(const StateT *in, StateT *out, int n,
+                                         StateT cutoff, StateT res) {
+    const int factor = mOversampling;
+    const int rampPos = mControlPhase * factor;
+    const int rampLength = mControlRate * factor;
+    if (mControlPhase == 0)
+      BeginControlPeriod<Model>(cutoff, res);
+    mControlPhase += n;
+    if (mControlPhase >= mControlRate)
+      mControlPhase = 0;
+    mControlPrimed = true;
+    n *= factor;
+
+    if constexpr (Model == FilterModel::Ladder) {
+      mLadderFilter.ProcessBlock(in, out, n, mLadderFrom, mLadderTo, rampPos,
+                                 rampLength);
+    } else if constexpr (Model == FilterModel::Cascade12 ||
+                         Model == FilterModel::Cascade24) {
+      mCascadeFilter.SetSlope(CascadeSlope<Model>());
+      mCascadeFilter.ProcessBlock(in, out, n, mCascadeFrom, mCascadeTo,
+                                  rampPos, rampLength);
+    } else {
+      mFilter.ProcessBlock(in, out, n, mBiquadFrom, mBiquadTo, rampPos,
+                           rampLength);
+    }
   }
 
-  void SetLFORouting(sample_t pitch, sample_t filter, sample_t amp,
-                     sample_t pan = sample_t(0)) {
-    mLfoPitchDepth = pitch;
-    mLfoFilterDepth = filter;
-    mLfoAmpDepth = amp;
-    mLfoPanDepth = pan;
+  // Control point: extrapolates the cutoff to the end of the period and
+  // starts the next coefficient ramp from where the previous one ended.
+  template <FilterModel Model>
+  SEA_INLINE void BeginControlPeriod(StateT cutoff, StateT res) {
+    // Force a full SetParams if the voice drops back to the audio-rate path.
+    mLastFilterCutoff = StateT(-1);
+    const StateT now = cutoff;
+    if (mControlPrimed) {
+      cutoff = std::clamp(now + (now - mControlCutoff), StateT(20.0),
+                          StateT(20000.0));
+    }
+    mControlCutoff = now;
+
+    if constexpr (Model == FilterModel::Ladder) {
+      const auto target = mLadderFilter.ComputeCoefficients(cutoff, res);
+      mLadderFrom = mControlPrimed ? mLadderTo : target;
+      mLadderTo = target;
+    } else if constexpr (Model == FilterModel::Cascade12 ||
+                         Model == FilterModel::Cascade24) {
+      const auto target = mCascadeFilter.ComputeCoefficients(cutoff, res);
+      mCascadeFrom = mControlPrimed ? mCascadeTo : target;
+      mCascadeTo = target;
+    } else {
+      const auto target =
+          mFilter.ComputeCoefficients(sea::FilterType::LowPass, cutoff, res);
+      mBiquadFrom = mControlPrimed ? mBiquadTo : target;
+      mBiquadTo = target;
+    }
   }
 
-  void SetPolyModOscBToFreqA(sample_t amount) { mPolyModOscBToFreqA = amount; }
-  void SetPolyModOscBToPWM(sample_t amount) { mPolyModOscBToPWM = amount; }
-  void SetPolyModOscBToFilter(sample_t amount) {
-    mPolyModOscBToFilter = amount;
-  }
-  void SetPolyModFilterEnvToFreqA(sample_t amount) {
-    mPolyModFilterEnvToFreqA = amount;
-  }
-  void SetPolyModFilterEnvToPWM(sample_t amount) {
-    mPolyModFilterEnvToPWM = amount;
-  }
-  void SetPolyModFilterEnvToFilter(sample_t amount) {
-    mPolyModFilterEnvToFilter = amount;
+  template <FilterModel Model>
+  static constexpr typename sea::CascadeFilter<StateT>::Slope CascadeSlope() {
+    return (Model == FilterModel::Cascade12)
+               ? sea::CascadeFilter<StateT>::Slope::dB12
+               : sea::CascadeFilter<StateT>::Slope::dB24;
   }
 
-private:
   void UpdatePanCache(float pan) {
     if (pan != mCachedPan) {
       mCachedPan = pan;
-      sample_t theta =
-          (static_cast<sample_t>(pan) + sample_t(1)) * (kPi / sample_t(4));
-      mPanLeft = sea::Math::Cos(theta);
-      mPanRight = sea::Math::Sin(theta);
+      T theta =
+          (static_cast<T>(pan) + T(1)) * (T(kPi) / T(4));
+      mPanLeft = T(sea::Math::Cos(theta));
+      mPanRight = T(sea::Math::Sin(theta));
     }
   }
 
-  sea::Oscillator mOscA;
-  sea::Oscillator mOscB;
-  sea::BiquadFilter<sample_t> mFilter;
-  sea::LadderFilter<sample_t> mLadderFilter;
-  sea::CascadeFilter<sample_t> mCascadeFilter;
-  sea::ADSREnvelope mAmpEnv;
-  sea::ADSREnvelope mFilterEnv;
-  sea::LFO mLfo;
+  // The voice's own block, written by the patch setters. Only valid while
+  // the voice is unbound (see DetachPatch()).
+  PatchParams &EditPatch() {
+    assert(!mSharedPatch && "patch setter on a bound voice; DetachPatch() first");
+    assert(mOwnPatch && "voice has no patch block of its own");
+    return *mOwnPatch;
+  }
+
+  // Read through GetPatch(): the shared block when bound, else the own
+  // block. Neither is owned.
+  const PatchParams *mSharedPatch = nullptr;
+  PatchParams *mOwnPatch = nullptr;
+
+  sea::BasicOscillator<T, PhaseT> mOscA;
+  sea::BasicOscillator<T, PhaseT> mOscB;
+  sea::BiquadFilter<StateT> mFilter;
+  sea::LadderFilter<StateT> mLadderFilter;
+  sea::CascadeFilter<StateT> mCascadeFilter;
+  sea::BasicADSREnvelope<T> mAmpEnv;
+  sea::BasicADSREnvelope<T> mFilterEnv;
+  // Envelope values pre-rendered for the current chunk (PrefillEnvelopes)
+  // in the caller's scratch; mEnvBlockPos is the next filter [0] and amp
+  // [1] value to consume. Only valid while mEnvBlockLen > 0.
+  EnvScratch *mEnvBlock = nullptr;
+  int mEnvBlockPos[2] = {0, 0};
+  int mEnvBlockLen = 0;
+  sea::BasicLFO<T, PhaseT> mLfo;
+  // Shared LFO (see BindLfoBus()), the next block position to read, and
+  // the retrigger offset taken at NoteOn.
+  const LfoBus *mLfoBus = nullptr;
+  int mLfoBusPos = 0;
+  bool mLfoRetriggered = false;
+  typename LfoBus::Offset mLfoOffset{};
+  sea::Oversampler<StateT> *mFilterOversampler = nullptr; // not owned
+  const sea::CutoffTable<StateT> *mCutoffTable = nullptr;
+  int mOversampling = 1; // see SetOversampling()
+  bool mOversampleOscillators = false;
 
   bool mActive = false;
-  sample_t mVelocity = 0.0;
+  T mVelocity = 0.0;
   int mNote = -1;
   uint32_t mAge = 0;
 
-  sample_t mFreq = 440.0;
-  sample_t mBaseCutoff = 2000.0;
-  sample_t mBaseRes = 0.707;
-  sample_t mFilterEnvAmount = 0.0;
-  FilterModel mFilterModel = FilterModel::Classic;
-
-  sample_t mMixA = 1.0;
-  sample_t mMixB = 0.0;
-  sample_t mDetuneB = 0.0;
-  sample_t mBasePulseWidthA = 0.5;
-  sample_t mBasePulseWidthB = 0.5;
-
-  sample_t mLfoPitchDepth = 0.0;
-  sample_t mLfoFilterDepth = 0.0;
-  sample_t mLfoAmpDepth = 0.0;
-  sample_t mLfoPanDepth = 0.0;
-
-  sample_t mPolyModOscBToFreqA = 0.0;
-  sample_t mPolyModOscBToPWM = 0.0;
-  sample_t mPolyModOscBToFilter = 0.0;
-  sample_t mPolyModFilterEnvToFreqA = 0.0;
-  sample_t mPolyModFilterEnvToPWM = 0.0;
-  sample_t mPolyModFilterEnvToFilter = 0.0;
+  T mFreq = 440.0;
+  FilterModel mRenderedModel = FilterModel::Classic; // see BeginRender()
 
   uint8_t mVoiceID = 0;
   VoiceState mVoiceState = VoiceState::Idle;
@@ -501,24 +1239,96 @@ private:
   float mPanPosition = 0.0f;
   float mLastLfoVal = 0.0f;
   float mStolenFadeGain = 0.0f;
-  sample_t mStolenFadeDelta = 0.0;
+  T mStolenFadeDelta = 0.0;
   float mLastAmpEnvVal = 0.0f;
+  int mQuietSamples = 0; // consecutive sub-threshold samples (release culling)
 
-  sample_t mTargetFreq = 440.0;
-  sample_t mGlideTime = 0.0;
+  T mTargetFreq = 440.0;
 
   // --- Cached values (recomputed in setters, not per-sample) ---
-  sample_t mDetuneFactor = 1.0;  // = pow(2.0, mDetuneB / 1200.0)
-  sample_t mGlideAlpha = 1.0;   // = 1.0 - exp(-kGlideTimeConstant / (mGlideTime * mSampleRate))
-  sample_t mLastFilterCutoff = sample_t(-1);  // impossible value forces first SetParams
-  sample_t mLastFilterRes = sample_t(-1);
-
-  sample_t mSampleRate = 48000.0;
+  StateT mLastFilterCutoff = StateT(-1);  // impossible value forces first SetParams
+  StateT mLastFilterRes = StateT(-1);
+
+  // --- Control-rate filter modulation (see SetControlRate) ---
+  using LadderCoeffs = typename sea::LadderFilter<StateT>::Coefficients;
+  using CascadeCoeffs = typename sea::CascadeFilter<StateT>::Coefficients;
+  using BiquadCoeffs = typename sea::BiquadFilter<StateT>::Coefficients;
+  int mControlRate = 1;
+  StateT mInvControlRate = StateT(1);
+  int mControlPhase = 0;
+  bool mControlPrimed = false;
+  StateT mControlCutoff = StateT(0); // cutoff at the last control point
+  LadderCoeffs mLadderFrom{};
+  LadderCoeffs mLadderTo{};
+  CascadeCoeffs mCascadeFrom{};
+  CascadeCoeffs mCascadeTo{};
+  BiquadCoeffs mBiquadFrom{};
+  BiquadCoeffs mBiquadTo{};
+
+  T mSampleRate = 48000.0;
 
   // --- Cached pan coefficients (recomputed only when pan changes) ---
   float mCachedPan = 0.0f;
-  sample_t mPanLeft = sample_t(0.70710678118654752);   // cos(pi/4) — center pan
-  sample_t mPanRight = sample_t(0.70710678118654752);  // sin(pi/4) — center pan
+  T mPanLeft = T(0.70710678118654752);   // cos(pi/4) — center pan
+  T mPanRight = T(0.70710678118654752);  // sin(pi/4) — center pan
+};
+
+// VoiceManager holds kMaxVoices voices and walks all of them every block,
+// so per-voice buffers live outside BasicVoice (the shared patch block,
+// BindOversampler(), EnvScratch). 1456 B (double) and 880 B (float) on
+// x86-64; check what a new member costs before raising these.
+static_assert(sizeof(BasicVoice<double>) <= 1536,
+              "BasicVoice<double> grew; keep large state out of the voice");
+static_assert(sizeof(BasicVoice<float>) <= 1024,
+              "BasicVoice<float> grew; keep large state out of the voice");
+
+// A voice that owns its patch block and oversampler, for use outside a
+// VoiceManager (tests, tools, single-voice hosts). VoiceManager's voices
+// are plain BasicVoices bound to state the manager holds, so they carry
+// neither.
+template <typename T, typename StateT = T>
+class BasicStandaloneVoice : public BasicVoice<T, StateT> {
+  using Base = BasicVoice<T, StateT>;
+
+public:
+  BasicStandaloneVoice() { Rebind(); }
+  // A copy keeps other's shared binding, if any, but owns a copy of its
+  // block.
+  BasicStandaloneVoice(const BasicStandaloneVoice &other)
+      : Base(other), mPatch(other.mPatch), mOversampler(other.mOversampler) {
+    Rebind();
+  }
+  BasicStandaloneVoice &operator=(const BasicStandaloneVoice &other) {
+    if (this != &other) {
+      Base::operator=(other);
+      mPatch = other.mPatch;
+      mOversampler = other.mOversampler;
+      Rebind();
+    }
+    return *this;
+  }
+
+  // Returns to the voice's own block after a BindPatch(), keeping the
+  // bound patch's values.
+  void DetachPatch() { Base::DetachPatch(mPatch); }
+
+  // ProcessBlock() with envelope scratch on the stack.
+  using Base::ProcessBlock;
+  void ProcessBlock(T *out, int nFrames) {
+    typename Base::EnvScratch scratch;
+    Base::ProcessBlock(out, nFrames, scratch);
+  }
+
+private:
+  void Rebind() {
+    Base::SetOwnPatch(&mPatch);
+    Base::BindOversampler(&mOversampler);
+  }
+
+  typename Base::PatchParams mPatch{};
+  sea::Oversampler<StateT> mOversampler;
 };
 
+using Voice = BasicStandaloneVoice<sample_t>;
+
 } // namespace PolySynthCore
@@ -0,0 +1,225 @@
+#pragma once
+
+#include "Voice.h"
+#include "types.h"
+#include <algorithm>
+#if POLYSYNTH_VOICE_BANK
+#include <sea_dsp/sea_adsr_lanes.h>
+#include <sea_dsp/sea_ladder_filter_lanes.h>
+#include <sea_dsp/sea_oscillator_lanes.h>
+#include <sea_dsp/sea_simd.h>
+#endif
+
+namespace PolySynthCore {
+
+// How VoiceManager::ProcessStereoBlock() holds voice state while it renders
+// (see VoiceManager::SetVoiceLayout()).
+enum class VoiceLayout {
+  Objects, // each voice renders from its own Voice object (default)
+  Bank     // eligible voices render in BasicVoiceBank lane groups
+};
+
+#if POLYSYNTH_VOICE_BANK
+// Structure-of-arrays voice bank.
+//
+// A Voice keeps its oscillators, envelopes and filters as member objects,
+// so the hot state of N voices is spread over N large objects. Render()
+// gathers the per-sample state of up to Lanes voices into contiguous
+// per-field lane arrays (oscillator phases and increments, envelope stages
+// and levels, ladder integrators and coefficients, velocities), renders
+// the block with fixed-width loops over those arrays (sea::OscillatorLanes,
+// sea::ADSRLanes, sea::LadderFilterLanes) that the compiler maps onto
+// SSE/AVX/NEON registers, and scatters the state back. Between blocks the
+// state lives in the voices, so a voice can move between the bank and its
+// own ProcessBlock() from one block to the next.
+//
+// The bank covers the fixed-pitch Ladder path at audio-rate filter
+// modulation: no LFO routing, glide in progress, poly-mod, pan modulation,
+// oversampling, control rate above 1, steal fade or release culling (see
+// CanRender()). For those voices each output sample is bit-identical to
+// Voice::ProcessBlock().
+template <typename T, typename StateT, int Lanes> class BasicVoiceBank {
+public:
+  using Voice = BasicVoice<T, StateT>;
+  using PatchParams = typename Voice::PatchParams;
+  using PhaseT = typename Voice::PhaseT;
+  static constexpr int kLanes = Lanes;
+
+  // True when v's next block can be rendered by a bank.
+  static bool CanRender(const Voice &v) {
+    const PatchParams &p = v.GetPatch();
+    const typename Voice::ModFlags flags = Voice::GetModFlags(p);
+    return v.CanBatchLadder() && v.mControlRate == 1 &&
+           v.HasFixedPitch(flags) && !flags.lfo && !flags.polyModFilter &&
+           v.mVoiceState != VoiceState::Stolen &&
+           !(p.cullThreshold > T(0) && v.mVoiceState == VoiceState::Release);
+  }
+
+  // Renders nFrames of count (<= Lanes) voices, outs[l] receiving
+  // group[l]'s mono output, as group[l]->ProcessBlock() would. Every voice
+  // must pass CanRender() and read the same patch block. V is BasicVoice
+  // or a subclass.
+  template <typename V>
+  void Render(V *const *group, int count, T *const *outs, int nFrames) {
+    static_assert(std::is_base_of_v<Voice, V>, "V must be a voice");
+    Voice *voices[Lanes] = {};
+    for (int l = 0; l < count; ++l)
+      voices[l] = group[l];
+    const PatchParams &p = voices[0]->GetPatch();
+    Load(voices, count, p);
+
+    // Cutoff terms that do not change within the block (TickPre() step 8;
+    // the LFO factor is 1 with no LFO routing).
+    const T envToCutoff = p.filterEnvAmount + p.polyModFilterEnvToFilter;
+    const StateT res = StateT(p.baseRes);
+
+    for (int i = 0; i < nFrames;) {
+      const int n = std::min(kRenderChunkSize, nFrames - i);
+      for (int l = 0; l < count; ++l) {
+        mOscA.SetActive(l, mLive[l]);
+        mOscB.SetActive(l, mLive[l]);
+      }
+      mOscB.ProcessBlock(mOscBOut, n);
+      mOscA.ProcessBlock(mOscAOut, n);
+      mFilterEnv.ProcessBlock(p.filterEnv, mFilterEnvOut, n);
+      mAmpEnv.ProcessBlock(p.ampEnv, mAmpEnvOut, n);
+      // A voice retires after the sample on which both envelopes are idle.
+      int retireAt[Lanes];
+      for (int l = 0; l < count; ++l)
+        retireAt[l] =
+            std::max(mAmpEnv.GetIdleFrom(l), mFilterEnv.GetIdleFrom(l));
+
+      for (int k = 0; k < n; ++k, ++i) {
+        const T *oscA = mOscAOut + k * Lanes;
+        const T *oscB = mOscBOut + k * Lanes;
+        const T *fenv = mFilterEnvOut + k * Lanes;
+        const T *amp = mAmpEnvOut + k * Lanes;
+        alignas(sea::simd::kAlignment) StateT in[Lanes];
+        alignas(sea::simd::kAlignment) StateT cutoff[Lanes];
+        alignas(sea::simd::kAlignment) StateT flt[Lanes];
+        for (int l = 0; l < Lanes; ++l) {
+          in[l] = StateT((oscA[l] * p.mixA) + (oscB[l] * p.mixB));
+          T c = p.baseCutoff;
+          c += fenv[l] * envToCutoff * T(kFilterEnvMaxHz);
+          cutoff[l] = StateT(std::clamp(c, T(20.0), T(20000.0)));
+        }
+        for (int l = 0; l < count; ++l) {
+          if (mLive[l] && (cutoff[l] != mCutoff[l] || res != mRes[l])) {
+            mCutoff[l] = cutoff[l];
+            mRes[l] = res;
+            mLadder.SetCoefficients(
+                l, voices[l]->mLadderFilter.ComputeCoefficients(cutoff[l],
+                                                                res));
+          }
+        }
+        mLadder.Process(in, flt);
+        for (int l = 0; l < count; ++l) {
+          if (!mLive[l]) {
+            outs[l][i] = T(0);
+            continue;
+          }
+          outs[l][i] = T(flt[l]) * amp[l] * mVelocity[l];
+          mLastAmp[l] = amp[l];
+          ++mAge[l];
+          if (k == retireAt[l]) {
+            mLive[l] = false;
+            mRetired[l] = true;
+            mLadder.SetActive(l, false);
+          }
+        }
+      }
+    }
+    Store(voices, count, nFrames);
+  }
+
+private:
+  void Load(Voice *const *voices, int count, const PatchParams &p) {
+    const typename Voice::ModFlags flags = Voice::GetModFlags(p);
+    // Lanes without an active voice stay idle and silent.
+    mOscA.Reset();
+    mOscB.Reset();
+    mAmpEnv.Reset();
+    mFilterEnv.Reset();
+    mLadder.Reset();
+    for (int l = 0; l < Lanes; ++l) {
+      mLive[l] = false;
+      mRetired[l] = false;
+    }
+    for (int l = 0; l < count; ++l) {
+      Voice &v = *voices[l];
+      assert(&v.GetPatch() == &p && CanRender(v));
+      if (!v.mActive)
+        continue;
+      v.BeginRender(p, flags);
+      v.mOscA.SetFrequency(v.mFreq);
+      v.mOscB.SetFrequency(v.mFreq * p.detuneFactor);
+      mOscA.Load(l, v.mOscA);
+      mOscB.Load(l, v.mOscB);
+      mAmpEnv.Load(l, v.mAmpEnv);
+      mFilterEnv.Load(l, v.mFilterEnv);
+      mLadder.Load(l, v.mLadderFilter);
+      mCutoff[l] = v.mLastFilterCutoff;
+      mRes[l] = v.mLastFilterRes;
+      mVelocity[l] = v.mVelocity;
+      mLastAmp[l] = T(v.mLastAmpEnvVal);
+      mAge[l] = v.mAge;
+      mLive[l] = true;
+    }
+  }
+
+  // Writes back what Tick() leaves in a voice: oscillator phases, envelope
+  // and ladder state, the filter's last coefficients, the per-sample
+  // bookkeeping and, for a voice that finished, its idle state.
+  void Store(Voice *const *voices, int count, int nFrames) {
+    for (int l = 0; l < count; ++l) {
+      Voice &v = *voices[l];
+      if (!mLive[l] && !mRetired[l])
+        continue;
+      mOscA.Store(l, v.mOscA);
+      mOscB.Store(l, v.mOscB);
+      mAmpEnv.Store(l, v.mAmpEnv);
+      mFilterEnv.Store(l, v.mFilterEnv);
+      mLadder.Store(l, v.mLadderFilter);
+      if (mCutoff[l] != v.mLastFilterCutoff || mRes[l] != v.mLastFilterRes) {
+        v.mLastFilterCutoff = mCutoff[l];
+        v.mLastFilterRes = mRes[l];
+        v.mLadderFilter.SetParams(sea::LadderFilter<StateT>::Model::Transistor,
+                                  mCutoff[l], mRes[l]);
+      }
+      if (nFrames > 0) {
+        v.mControlPrimed = false;
+        v.mLastLfoVal = 0.0f;
+      }
+      v.mLastAmpEnvVal = static_cast<float>(mLastAmp[l]);
+      v.mAge = mAge[l];
+      if (mRetired[l]) {
+        v.mActive = false;
+        v.mNote = -1;
+        v.mAge = 0;
+        v.mVoiceState = VoiceState::Idle;
+      }
+    }
+  }
+
+  sea::OscillatorLanes<T, PhaseT, Lanes> mOscA;
+  sea::OscillatorLanes<T, PhaseT, Lanes> mOscB;
+  sea::ADSRLanes<T, Lanes> mAmpEnv;
+  sea::ADSRLanes<T, Lanes> mFilterEnv;
+  sea::LadderFilterLanes<StateT, Lanes> mLadder;
+  alignas(sea::simd::kAlignment) StateT mCutoff[Lanes];
+  alignas(sea::simd::kAlignment) StateT mRes[Lanes];
+  alignas(sea::simd::kAlignment) T mVelocity[Lanes];
+  alignas(sea::simd::kAlignment) T mLastAmp[Lanes];
+  uint32_t mAge[Lanes];
+  bool mLive[Lanes];
+  bool mRetired[Lanes];
+
+  // One chunk of every lane, lane-interleaved ([sample * Lanes + lane]).
+  alignas(sea::simd::kAlignment) T mOscAOut[kRenderChunkSize * Lanes];
+  alignas(sea::simd::kAlignment) T mOscBOut[kRenderChunkSize * Lanes];
+  alignas(sea::simd::kAlignment) T mFilterEnvOut[kRenderChunkSize * Lanes];
+  alignas(sea::simd::kAlignment) T mAmpEnvOut[kRenderChunkSize * Lanes];
+};
+#endif // POLYSYNTH_VOICE_BANK
+
+} // namespace PolySynthCore
@@ -1,38 +1,67 @@
 #pragma once
 
 #include "Voice.h"
+#include "VoiceBank.h"
 #include "types.h"
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <memory>
 #include <sea_util/sea_voice_allocator.h>
 
+#if POLYSYNTH_PARALLEL_VOICES
+#include "VoiceRenderPool.h"
+#include <vector>
+#endif
+
 namespace PolySynthCore {
 
-class VoiceManager {
+// Voice pool, allocation and mixing. T / StateT select the voice precision
+// (see BasicVoice); VoiceManager is the sample_t instantiation.
+template <typename T, typename StateT = T>
+class BasicVoiceManager {
 public:
+  using Voice = BasicVoice<T, StateT>;
   static constexpr int kNumVoices = kMaxVoices;
+  // Ladder voices render this many at a time through
+  // Voice::ProcessLadderBlock() (one SIMD register of StateT); 1 = scalar
+  // target, no batching.
+  static constexpr int kLadderLanes = sea::simd::kLanes<StateT>;
+#if POLYSYNTH_VOICE_BANK
+  using VoiceBank = BasicVoiceBank<T, StateT, kLadderLanes>;
+#endif
 
   // Pre-computed headroom scaling: 1/sqrt(kNumVoices)
-  static inline const sample_t kHeadroomScale =
-      sample_t(1) / std::sqrt(static_cast<sample_t>(kNumVoices));
+  static inline const T kHeadroomScale =
+      T(1) / std::sqrt(static_cast<T>(kNumVoices));
 
-  VoiceManager() = default;
+  BasicVoiceManager() = default;
 
-  void Init(sample_t sampleRate) {
+  void Init(T sampleRate) {
     mSampleRate = sampleRate;
     mGlobalTimestamp = 0;
+    mVoices.patch.Init(sampleRate);
+    mVoices.cutoffTable.Init(static_cast<StateT>(sampleRate));
+    mVoices.lfoBus.Init(sampleRate);
     for (int i = 0; i < kNumVoices; i++) {
       mVoices[i].Init(sampleRate, static_cast<uint8_t>(i));
+      mVoices[i].SetControlRate(mControlRate);
+      mVoices[i].SetOversampling(mOversampling, mOversampleOscillators);
     }
+    ClearActiveList();
     mAllocator.SetPolyphonyLimit(kNumVoices);
   }
 
   void Reset() {
     mGlobalTimestamp = 0;
+    mVoices.patch.Init(mSampleRate);
+    mVoices.lfoBus.Init(mSampleRate);
     for (int i = 0; i < kNumVoices; i++) {
       mVoices[i].Init(mSampleRate, static_cast<uint8_t>(i));
+      mVoices[i].SetControlRate(mControlRate);
+      mVoices[i].SetOversampling(mOversampling, mOversampleOscillators);
     }
+    ClearActiveList();
   }
 
   void OnNoteOn(int note, int velocity) {
@@ -46,6 +75,7 @@ public:
         break; // No voice available
 
       mVoices[idx].NoteOn(note, velocity, ++mGlobalTimestamp);
+      TrackActiveSlot(idx, note);
 
       // Apply unison detune and pan
       auto info = mAllocator.GetUnisonVoiceInfo(u);
@@ -54,9 +84,9 @@ public:
       // to spread voices across the stereo field.
       if (mAllocator.GetUnisonCount() <= 1 &&
           mAllocator.GetStereoSpread() > 0.0) {
-        sample_t spread = mAllocator.GetStereoSpread();
+        T spread = mAllocator.GetStereoSpread();
         // Alternate L/R panning per voice slot
-        sample_t pan = (idx % 2 == 0) ? -spread : spread;
+        T pan = (idx % 2 == 0) ? -spread : spread;
         info.panPosition = pan;
       }
 
@@ -72,12 +102,7 @@ public:
       mAllocator.MarkSustained(note);
       return;
     }
-    // Release all voices playing this note
-    for (auto &voice : mVoices) {
-      if (voice.IsActive() && voice.GetNote() == note) {
-        voice.NoteOff();
-      }
-    }
+    ReleaseNote(note);
   }
 
   void OnSustainPedal(bool down) {
@@ -87,11 +112,7 @@ public:
       int releasedNotes[128];
       int count = mAllocator.ReleaseSustainedNotes(releasedNotes, 128);
       for (int i = 0; i < count; i++) {
-        for (auto &voice : mVoices) {
-          if (voice.IsActive() && voice.GetNote() == releasedNotes[i]) {
-            voice.NoteOff();
-          }
-        }
+        ReleaseNote(releasedNotes[i]);
       }
     }
   }
@@ -111,90 +132,214 @@ public:
     mAllocator.SetStealPriority(static_cast<sea::StealPriority>(priority));
   }
   void SetUnisonCount(int count) { mAllocator.SetUnisonCount(count); }
-  void SetUnisonSpread(sample_t spread) { mAllocator.SetUnisonSpread(spread); }
-  void SetStereoSpread(sample_t spread) { mAllocator.SetStereoSpread(spread); }
+  void SetUnisonSpread(T spread) { mAllocator.SetUnisonSpread(spread); }
+  void SetStereoSpread(T spread) { mAllocator.SetStereoSpread(spread); }
 
-  inline sample_t Process() {
-    sample_t sum = sample_t(0);
-    for (auto &voice : mVoices) {
-      sum += voice.Process();
-    }
+  inline T Process() {
+    RenderLfoBus(1);
+    T sum = T(0);
+    RenderActiveVoices([&](Voice &voice, int) { sum += voice.Process(); });
     return sum * kHeadroomScale;
   }
 
   // Diagnostic version: captures per-voice mono peak levels
-  inline void ProcessStereoDiag(sample_t &outLeft, sample_t &outRight, float* voicePeaks) {
-    outLeft = sample_t(0);
-    outRight = sample_t(0);
+  inline void ProcessStereoDiag(T &outLeft, T &outRight, float* voicePeaks) {
+    outLeft = T(0);
+    outRight = T(0);
+    RenderLfoBus(1);
 
-    for (int i = 0; i < kNumVoices; i++) {
-      sample_t mono = mVoices[i].Process();
+    RenderActiveVoices([&](Voice &voice, int i) {
+      T mono = voice.Process();
       float absMono = mono > 0 ? static_cast<float>(mono) : static_cast<float>(-mono);
       if (absMono > voicePeaks[i]) voicePeaks[i] = absMono;
-      if (mono == sample_t(0))
-        continue;
+      if (mono == T(0))
+        return;
 
-      sample_t panL, panR;
-      mVoices[i].GetPanCoefficients(panL, panR);
+      T panL, panR;
+      voice.GetPanCoefficients(panL, panR);
       outLeft += mono * panL;
       outRight += mono * panR;
-    }
+    });
     outLeft *= kHeadroomScale;
     outRight *= kHeadroomScale;
   }
 
-  inline void ProcessStereo(sample_t &outLeft, sample_t &outRight) {
-    outLeft = sample_t(0);
-    outRight = sample_t(0);
+  inline void ProcessStereo(T &outLeft, T &outRight) {
+    outLeft = T(0);
+    outRight = T(0);
+    RenderLfoBus(1);
 
-    for (auto &voice : mVoices) {
-      sample_t mono = voice.Process();
-      if (mono == sample_t(0))
-        continue;
+    RenderActiveVoices([&](Voice &voice, int) {
+      T mono = voice.Process();
+      if (mono == T(0))
+        return;
 
       // Use cached pan coefficients (sin/cos computed only when pan changes)
-      sample_t panL, panR;
+      T panL, panR;
       voice.GetPanCoefficients(panL, panR);
       outLeft += mono * panL;
       outRight += mono * panR;
-    }
+    });
     // Headroom scaling
     outLeft *= kHeadroomScale;
     outRight *= kHeadroomScale;
   }
 
-  void SetGlideTime(sample_t seconds) {
-    for (auto &voice : mVoices) {
-      voice.SetGlideTime(seconds);
+  // Block version of ProcessStereo(): renders nFrames (<= kRenderChunkSize)
+  // into outLeft/outRight. Each voice renders its whole block through
+  // Voice::ProcessBlock() and is accumulated in slot order, so the per-sample
+  // summation order — and therefore the output — matches ProcessStereo().
+  // Voices with LFO pan modulation need per-sample pan coefficients and
+  // take the per-sample path. Ladder-model voices are first rendered
+  // kLadderLanes at a time (see RenderLadderGroups, SetVoiceLayout); their
+  // output is the same, so batching does not change the mix. The shared LFO
+  // (see SetLFOMode()) is rendered once for the block before any voice runs.
+  void ProcessStereoBlock(T *outLeft, T *outRight, int nFrames) {
+    RenderLfoBus(nFrames);
+#if POLYSYNTH_PARALLEL_VOICES
+    if (mRenderPool.GetNumWorkers() > 0 && mActiveCount > 1) {
+      ProcessStereoBlockParallel(outLeft, outRight, nFrames);
+      return;
+    }
+#endif
+    for (int i = 0; i < nFrames; ++i) {
+      outLeft[i] = T(0);
+      outRight[i] = T(0);
     }
-  }
 
-  void SetADSR(sample_t a, sample_t d, sample_t s, sample_t r) {
-    for (auto &voice : mVoices) {
-      voice.SetADSR(a, d, s, r);
+    if constexpr (kLadderLanes > 1)
+      RenderLadderGroups(nFrames);
+
+    RenderActiveVoices([&](Voice &voice, int idx) {
+      T panL, panR;
+      if constexpr (kLadderLanes > 1) {
+        if (mLadderBatched[idx]) {
+          const T *mono = mLadderOut[idx].data();
+          voice.GetPanCoefficients(panL, panR);
+          for (int i = 0; i < nFrames; ++i) {
+            outLeft[i] += mono[i] * panL;
+            outRight[i] += mono[i] * panR;
+          }
+          return;
+        }
+      }
+      if (voice.HasPanModulation()) {
+        for (int i = 0; i < nFrames; ++i) {
+          T mono = voice.Process();
+          if (mono == T(0))
+            continue;
+          voice.GetPanCoefficients(panL, panR);
+          outLeft[i] += mono * panL;
+          outRight[i] += mono * panR;
+        }
+        return;
+      }
+
+      T *mono = mVoiceScratch.data();
+      voice.ProcessBlock(mono, nFrames, mEnvScratch);
+      voice.GetPanCoefficients(panL, panR);
+      for (int i = 0; i < nFrames; ++i) {
+        outLeft[i] += mono[i] * panL;
+        outRight[i] += mono[i] * panR;
+      }
+    });
+
+    for (int i = 0; i < nFrames; ++i) {
+      outLeft[i] *= kHeadroomScale;
+      outRight[i] *= kHeadroomScale;
     }
   }
 
-  void SetFilterEnv(sample_t a, sample_t d, sample_t s, sample_t r) {
-    for (auto &voice : mVoices) {
-      voice.SetFilterEnv(a, d, s, r);
-    }
+#if POLYSYNTH_PARALLEL_VOICES
+  // Renders voices on `threads` cores, the audio thread included (1 = serial,
+  // the default). Spawns/joins worker threads: call from a non-audio thread
+  // while audio is stopped, e.g. on plugin activation.
+  void SetRenderThreads(int threads) {
+    mRenderPool.Start(threads - 1);
+    mWorkerEnvScratch.resize(
+        static_cast<size_t>(mRenderPool.GetNumWorkers()));
   }
+  int GetRenderThreads() const { return mRenderPool.GetNumWorkers() + 1; }
+#endif
 
-  void SetFilter(sample_t cutoff, sample_t res, sample_t envAmount) {
-    for (auto &voice : mVoices) {
-      voice.SetFilter(cutoff, res, envAmount);
-    }
+  void SetGlideTime(T seconds) {
+    mVoices.patch.SetGlideTime(seconds);
+  }
+
+  void SetADSR(T a, T d, T s, T r) {
+    mVoices.patch.SetADSR(a, d, s, r);
+  }
+
+  void SetFilterEnv(T a, T d, T s, T r) {
+    mVoices.patch.SetFilterEnv(a, d, s, r);
+  }
+
+  void SetFilter(T cutoff, T res, T envAmount) {
+    mVoices.patch.SetFilter(cutoff, res, envAmount);
   }
 
   void SetFilterModel(int model) {
     int clamped = std::clamp(model, 0, 3);
-    auto filterModel = static_cast<Voice::FilterModel>(clamped);
+    mVoices.patch.filterModel = static_cast<VoiceFilterModel>(clamped);
+  }
+
+  // Release-tail culling threshold in dBFS; see
+  // PatchParams::SetReleaseCulling().
+  void SetReleaseCulling(T thresholdDb) {
+    mVoices.patch.SetReleaseCulling(thresholdDb);
+  }
+
+  // Filter cutoff -> coefficient lookup tables (off by default): modulated
+  // filters read one table, built at Init() and shared by every voice,
+  // instead of evaluating Tan/Sin/Cos. Coefficients then differ from the
+  // exact ones by the interpolation error (under 0.05 cent of cutoff below
+  // 10 kHz, about 1 cent at the top of the range). Survives Init().
+  void SetFilterTables(bool enabled) {
+    mVoices.useCutoffTable = enabled;
+    mVoices.Bind();
+  }
+  bool GetFilterTables() const { return mVoices.useCutoffTable; }
+
+  // How the serial block path renders Ladder-model voices (see
+  // RenderLadderGroups()). Objects (the default) runs each voice's own
+  // objects, the filters of kLadderLanes voices side by side. Bank renders
+  // the voices BasicVoiceBank::CanRender() accepts through a
+  // structure-of-arrays bank instead: their oscillator phases, envelope
+  // levels, ladder integrators and coefficients are gathered into per-field
+  // lane arrays for the block. The mix is the same either way. Ignored by
+  // the multi-threaded path and on scalar targets (kLadderLanes == 1).
+  void SetVoiceLayout(VoiceLayout layout) { mVoiceLayout = layout; }
+  VoiceLayout GetVoiceLayout() const { return mVoiceLayout; }
+
+  // Filter modulation rate in samples; see Voice::SetControlRate().
+  void SetControlRate(int samples) {
+    mControlRate = std::clamp(samples, 1, kMaxControlRate);
     for (auto &voice : mVoices) {
-      voice.SetFilterModel(filterModel);
+      voice.SetControlRate(mControlRate);
     }
   }
 
+  // Filter (and optionally oscillator) oversampling; see
+  // Voice::SetOversampling(). Not realtime-safe: resets every voice's
+  // filter state, and allocates the voices' resampler state on the way up
+  // from 1x (freed again on the way back).
+  void SetOversampling(int factor, bool oscillators = false) {
+    if (factor <= 1)
+      mVoices.oversamplers.reset();
+    else if (!mVoices.oversamplers)
+      mVoices.oversamplers =
+          std::make_unique<sea::Oversampler<StateT>[]>(kNumVoices);
+    mVoices.Bind();
+    for (auto &voice : mVoices)
+      voice.SetOversampling(factor, oscillators);
+    mOversampling = mVoices[0].GetOversampling();
+    mOversampleOscillators = mVoices[0].GetOversampleOscillators();
+  }
+  int GetOversampling() const { return mOversampling; }
+  T GetOversamplingLatency() const {
+    return mVoices[0].GetOversamplingLatency();
+  }
+
   void SetWaveform(sea::Oscillator::WaveformType type) {
     for (auto &voice : mVoices) {
       voice.SetWaveform(type);
@@ -213,96 +358,84 @@ public:
     }
   }
 
-  void SetPulseWidth(sample_t pw) {
+  void SetOscillatorAntialias(sea::OscillatorAntialias oscA,
+                              sea::OscillatorAntialias oscB) {
     for (auto &voice : mVoices) {
-      voice.SetPulseWidth(pw);
+      voice.SetAntialiasA(oscA);
+      voice.SetAntialiasB(oscB);
     }
   }
 
-  void SetPulseWidthA(sample_t pw) {
-    for (auto &voice : mVoices) {
-      voice.SetPulseWidthA(pw);
-    }
+  void SetPulseWidth(T pw) {
+    mVoices.patch.SetPulseWidthA(pw);
   }
 
-  void SetPulseWidthB(sample_t pw) {
-    for (auto &voice : mVoices) {
-      voice.SetPulseWidthB(pw);
-    }
+  void SetPulseWidthA(T pw) {
+    mVoices.patch.SetPulseWidthA(pw);
   }
 
-  void SetMixer(sample_t mixA, sample_t mixB, sample_t detuneB) {
-    for (auto &voice : mVoices) {
-      voice.SetMixer(mixA, mixB, detuneB);
-    }
+  void SetPulseWidthB(T pw) {
+    mVoices.patch.SetPulseWidthB(pw);
   }
 
-  void SetLFO(int type, sample_t rate, sample_t depth) {
+  void SetMixer(T mixA, T mixB, T detuneB) {
+    mVoices.patch.SetMixer(mixA, mixB, detuneB);
+  }
+
+  void SetLFO(int type, T rate, T depth) {
+    mVoices.lfoBus.SetLFO(type, rate, depth);
     for (auto &voice : mVoices) {
       voice.SetLFO(type, rate, depth);
     }
   }
 
-  void SetLFORouting(sample_t pitch, sample_t filter, sample_t amp,
-                     sample_t pan = sample_t(0)) {
-    for (auto &voice : mVoices) {
-      voice.SetLFORouting(pitch, filter, amp, pan);
-    }
+  // LfoMode::Free and Retrigger run one LFO for all voices, rendered once
+  // per block into a shared bus: one waveform evaluation per sample instead
+  // of one per voice. Retrigger restarts each voice's cycle at its NoteOn by
+  // rotating the shared sine (see BasicLfoBus). PerVoice (default) keeps an
+  // independent LFO in every voice, which is how voices sounded before the
+  // bus existed. A mode change applies to sounding voices at once;
+  // Retrigger offsets are taken at the next NoteOn.
+  void SetLFOMode(LfoMode mode) {
+    mVoices.lfoMode = mode;
+    mVoices.lfoBus.SetRetrigger(mode == LfoMode::Retrigger);
+    mVoices.Bind();
   }
+  LfoMode GetLFOMode() const { return mVoices.lfoMode; }
 
-  void SetPolyModOscBToFreqA(sample_t amount) {
-    for (auto &voice : mVoices) {
-      voice.SetPolyModOscBToFreqA(amount);
-    }
+  void SetLFORouting(T pitch, T filter, T amp,
+                     T pan = T(0)) {
+    mVoices.patch.SetLFORouting(pitch, filter, amp, pan);
   }
 
-  void SetPolyModOscBToPWM(sample_t amount) {
-    for (auto &voice : mVoices) {
-      voice.SetPolyModOscBToPWM(amount);
-    }
+  void SetPolyModOscBToFreqA(T amount) {
+    mVoices.patch.polyModOscBToFreqA = amount;
   }
 
-  void SetPolyModOscBToFilter(sample_t amount) {
-    for (auto &voice : mVoices) {
-      voice.SetPolyModOscBToFilter(amount);
-    }
+  void SetPolyModOscBToPWM(T amount) {
+    mVoices.patch.polyModOscBToPWM = amount;
   }
 
-  void SetPolyModFilterEnvToFreqA(sample_t amount) {
-    for (auto &voice : mVoices) {
-      voice.SetPolyModFilterEnvToFreqA(amount);
-    }
+  void SetPolyModOscBToFilter(T amount) {
+    mVoices.patch.polyModOscBToFilter = amount;
   }
 
-  void SetPolyModFilterEnvToPWM(sample_t amount) {
-    for (auto &voice : mVoices) {
-      voice.SetPolyModFilterEnvToPWM(amount);
-    }
+  void SetPolyModFilterEnvToFreqA(T amount) {
+    mVoices.patch.polyModFilterEnvToFreqA = amount;
   }
 
-  void SetPolyModFilterEnvToFilter(sample_t amount) {
-    for (auto &voice : mVoices) {
-      voice.SetPolyModFilterEnvToFilter(amount);
-    }
+  void SetPolyModFilterEnvToPWM(T amount) {
+    mVoices.patch.polyModFilterEnvToPWM = amount;
   }
 
-  int GetActiveVoiceCount() const {
-    int count = 0;
-    for (const auto &voice : mVoices) {
-      if (voice.IsActive()) {
-        ++count;
-      }
-    }
-    return count;
+  void SetPolyModFilterEnvToFilter(T amount) {
+    mVoices.patch.polyModFilterEnvToFilter = amount;
   }
 
+  int GetActiveVoiceCount() const { return mActiveCount; }
+
   bool IsNoteActive(int note) const {
-    for (const auto &voice : mVoices) {
-      if (voice.IsActive() && voice.GetNote() == note) {
-        return true;
-      }
-    }
-    return false;
+    return note >= 0 && note < 128 && mNoteVoiceCount[note] > 0;
   }
 
   uint32_t GetGlobalTimestamp() const { return mGlobalTimestamp; }
@@ -318,8 +451,9 @@ public:
 
   int GetHeldNotes(std::array<int, kMaxVoices> &buf) const {
     int count = 0;
-    for (const auto &voice : mVoices) {
-      if (voice.IsActive() && voice.GetNote() >= 0) {
+    for (int k = 0; k < mActiveCount; k++) {
+      const Voice &voice = mVoices[mActiveList[k]];
+      if (voice.GetNote() >= 0) {
         const int note = voice.GetNote();
         bool found = false;
         for (int j = 0; j < count; j++) {
@@ -337,10 +471,308 @@ public:
   }
 
 private:
-  std::array<Voice, kNumVoices> mVoices;
+  // ─── Active-voice bookkeeping ─────────────────────────────────────────
+  // mActiveList holds the indices of sounding voices in ascending slot order
+  // (so the mix is summed in the same order as a full slot scan).
+  // mNoteVoiceCount counts sounding voices per MIDI note. Both are updated
+  // on NoteOn/steal and when a voice goes idle during rendering, so
+  // rendering and note queries cost O(active voices), not O(kMaxVoices).
+
+  void ClearActiveList() {
+    mActiveCount = 0;
+    mInActiveList.fill(false);
+    mSlotNote.fill(-1);
+    mNoteVoiceCount.fill(0);
+  }
+
+  void CountNote(int note, int delta) {
+    if (note >= 0 && note < 128)
+      mNoteVoiceCount[note] = static_cast<uint16_t>(mNoteVoiceCount[note] + delta);
+  }
+
+  // Called after mVoices[idx].NoteOn(): adds the slot to the active list or,
+  // for a retriggered/stolen voice, moves its note count to the new note.
+  void TrackActiveSlot(int idx, int note) {
+    if (mInActiveList[idx]) {
+      CountNote(mSlotNote[idx], -1);
+    } else {
+      int pos = mActiveCount;
+      while (pos > 0 && mActiveList[pos - 1] > idx) {
+        mActiveList[pos] = mActiveList[pos - 1];
+        --pos;
+      }
+      mActiveList[pos] = idx;
+      ++mActiveCount;
+      mInActiveList[idx] = true;
+    }
+    mSlotNote[idx] = note;
+    CountNote(note, +1);
+  }
+
+  void ReleaseNote(int note) {
+    if (!IsNoteActive(note))
+      return;
+    for (int k = 0; k < mActiveCount; k++) {
+      Voice &voice = mVoices[mActiveList[k]];
+      if (voice.IsActive() && voice.GetNote() == note) {
+        voice.NoteOff();
+      }
+    }
+  }
+
+  // Runs render(voice, slotIndex) for every active voice in slot order and
+  // drops voices that went idle while rendering.
+  template <typename RenderFn> SEA_INLINE void RenderActiveVoices(RenderFn &&render) {
+    for (int k = 0; k < mActiveCount; k++) {
+      const int idx = mActiveList[k];
+      render(mVoices[idx], idx);
+    }
+    CompactActiveList();
+  }
+
+  // Renders the next nFrames of the shared LFO and rewinds the active voices
+  // to its start. While no voice routes the LFO anywhere nothing reads it,
+  // so it only advances. Voices bound to the shared patch route it exactly
+  // when the patch does, so the decision follows patch parameters and block
+  // and per-sample rendering step the LFO identically; an active voice on
+  // its own patch (see Voice::DetachPatch()) is checked as well.
+  void RenderLfoBus(int nFrames) {
+    if (mVoices.lfoMode == LfoMode::PerVoice)
+      return;
+    bool needed = mVoices.patch.HasLfoRouting();
+    for (int k = 0; k < mActiveCount && !needed; k++)
+      needed = mVoices[mActiveList[k]].GetPatch().HasLfoRouting();
+    if (!needed) {
+      mVoices.lfoBus.Skip(nFrames);
+      return;
+    }
+    mVoices.lfoBus.Render(nFrames, mVoices.lfoMode == LfoMode::Retrigger);
+    for (int k = 0; k < mActiveCount; k++)
+      mVoices[mActiveList[k]].RewindLfoBus();
+  }
+
+  // Renders the active Ladder-model voices with a fixed pan in groups of
+  // kLadderLanes (active-list order) into mLadderOut and marks them in
+  // mLadderBatched. In the Bank layout the voices the bank can render form
+  // their own groups. A lone leftover voice of either kind is left to the
+  // scalar path.
+  void RenderLadderGroups(int nFrames) {
+    struct Group {
+      Voice *voices[kLadderLanes];
+      T *outs[kLadderLanes];
+      int slots[kLadderLanes];
+      int count = 0;
+    };
+    Group ladder;
+    Group bank;
+    auto flush = [&](Group &g, bool toBank) {
+      if (g.count > 1) {
+#if POLYSYNTH_VOICE_BANK
+        if (toBank)
+          mVoiceBank.Render(g.voices, g.count, g.outs, nFrames);
+        else
+#else
+        (void)toBank;
+#endif
+          Voice::template ProcessLadderBlock<kLadderLanes>(g.voices, g.count,
+                                                           g.outs, nFrames);
+      } else if (g.count == 1) {
+        mLadderBatched[g.slots[0]] = false;
+      }
+      g.count = 0;
+    };
+    for (int k = 0; k < mActiveCount; k++) {
+      const int idx = mActiveList[k];
+      Voice &voice = mVoices[idx];
+      mLadderBatched[idx] = voice.CanBatchLadder();
+      if (!mLadderBatched[idx])
+        continue;
+      bool toBank = false;
+#if POLYSYNTH_VOICE_BANK
+      toBank = mVoiceLayout == VoiceLayout::Bank &&
+               &voice.GetPatch() == &mVoices.patch &&
+               VoiceBank::CanRender(voice);
+#endif
+      Group &g = toBank ? bank : ladder;
+      g.voices[g.count] = &voice;
+      g.outs[g.count] = mLadderOut[idx].data();
+      g.slots[g.count] = idx;
+      if (++g.count == kLadderLanes)
+        flush(g, toBank);
+    }
+    flush(ladder, false);
+    flush(bank, true);
+  }
+
+  // Drops voices that went idle from the active list (order preserved).
+  void CompactActiveList() {
+    int kept = 0;
+    for (int k = 0; k < mActiveCount; k++) {
+      const int idx = mActiveList[k];
+      if (mVoices[idx].IsActive()) {
+        mActiveList[kept++] = idx;
+      } else {
+        mInActiveList[idx] = false;
+        CountNote(mSlotNote[idx], -1);
+        mSlotNote[idx] = -1;
+      }
+    }
+    mActiveCount = kept;
+  }
+
+#if POLYSYNTH_PARALLEL_VOICES
+  // Each active voice renders its panned output into its own bus on
+  // whichever core picks it up; the buses are then summed on the audio
+  // thread in slot order, so the mix is bit-identical for any thread count.
+  void ProcessStereoBlockParallel(T *outLeft, T *outRight,
+                                  int nFrames) {
+    auto renderVoice = [this, nFrames](int k, int participant) {
+      const int idx = mActiveList[k];
+      Voice &voice = mVoices[idx];
+      T *busL = mVoiceBusL[idx].data();
+      T *busR = mVoiceBusR[idx].data();
+      T panL, panR;
+      if (voice.HasPanModulation()) {
+        for (int i = 0; i < nFrames; ++i) {
+          const T mono = voice.Process();
+          voice.GetPanCoefficients(panL, panR);
+          busL[i] = mono * panL;
+          busR[i] = mono * panR;
+        }
+        return;
+      }
+      voice.ProcessBlock(busL, nFrames,
+                         participant == 0
+                             ? mEnvScratch
+                             : mWorkerEnvScratch[static_cast<size_t>(
+                                   participant - 1)]);
+      voice.GetPanCoefficients(panL, panR);
+      for (int i = 0; i < nFrames; ++i) {
+        busR[i] = busL[i] * panR;
+        busL[i] = busL[i] * panL;
+      }
+    };
+    mRenderPool.Run(mActiveCount, renderVoice);
+
+    for (int i = 0; i < nFrames; ++i) {
+      outLeft[i] = T(0);
+      outRight[i] = T(0);
+    }
+    for (int k = 0; k < mActiveCount; k++) {
+      const T *busL = mVoiceBusL[mActiveList[k]].data();
+      const T *busR = mVoiceBusR[mActiveList[k]].data();
+      for (int i = 0; i < nFrames; ++i) {
+        outLeft[i] += busL[i];
+        outRight[i] += busR[i];
+      }
+    }
+    CompactActiveList();
+
+    for (int i = 0; i < nFrames; ++i) {
+      outLeft[i] *= kHeadroomScale;
+      outRight[i] *= kHeadroomScale;
+    }
+  }
+
+  using VoiceBus = std::array<T, kRenderChunkSize>;
+  std::array<VoiceBus, kNumVoices> mVoiceBusL{};
+  std::array<VoiceBus, kNumVoices> mVoiceBusR{};
+  VoiceRenderPool mRenderPool;
+  // Envelope scratch for pool workers 1..N (the audio thread uses
+  // mEnvScratch); sized by SetRenderThreads().
+  std::vector<typename Voice::EnvScratch> mWorkerEnvScratch;
+#endif
+
+  // The voices plus the patch block, cutoff table and LFO bus they all read
+  // (see VoicePatchParams, SetFilterTables(), SetLFOMode()) and their
+  // oversamplers, one per voice while SetOversampling() is above 1x. Kept
+  // in one object so that copying a VoiceManager rebinds the copied voices
+  // to the copy's own.
+  struct VoiceSlots {
+    typename Voice::PatchParams patch;
+    sea::CutoffTable<StateT> cutoffTable;
+    bool useCutoffTable = false;
+    typename Voice::LfoBus lfoBus;
+    LfoMode lfoMode = LfoMode::PerVoice;
+    std::unique_ptr<sea::Oversampler<StateT>[]> oversamplers;
+    std::array<Voice, kNumVoices> voices;
+
+    VoiceSlots() { Bind(); }
+    VoiceSlots(const VoiceSlots &other)
+        : patch(other.patch), cutoffTable(other.cutoffTable),
+          useCutoffTable(other.useCutoffTable), lfoBus(other.lfoBus),
+          lfoMode(other.lfoMode), voices(other.voices) {
+      CopyOversamplers(other);
+      Bind();
+    }
+    VoiceSlots &operator=(const VoiceSlots &other) {
+      patch = other.patch;
+      cutoffTable = other.cutoffTable;
+      useCutoffTable = other.useCutoffTable;
+      lfoBus = other.lfoBus;
+      lfoMode = other.lfoMode;
+      voices = other.voices;
+      CopyOversamplers(other);
+      Bind();
+      return *this;
+    }
+    void CopyOversamplers(const VoiceSlots &other) {
+      if (!other.oversamplers) {
+        oversamplers.reset();
+        return;
+      }
+      if (!oversamplers)
+        oversamplers =
+            std::make_unique<sea::Oversampler<StateT>[]>(kNumVoices);
+      std::copy(other.oversamplers.get(),
+                other.oversamplers.get() + kNumVoices, oversamplers.get());
+    }
+    void Bind() {
+      for (int i = 0; i < kNumVoices; ++i) {
+        Voice &voice = voices[i];
+        voice.BindPatch(&patch);
+        voice.BindOversampler(oversamplers ? &oversamplers[i] : nullptr);
+        voice.SetCutoffTable(useCutoffTable ? &cutoffTable : nullptr);
+        voice.BindLfoBus(lfoMode == LfoMode::PerVoice ? nullptr : &lfoBus);
+      }
+    }
+
+    Voice &operator[](int i) { return voices[i]; }
+    const Voice &operator[](int i) const { return voices[i]; }
+    Voice *data() { return voices.data(); }
+    Voice *begin() { return voices.data(); }
+    Voice *end() { return voices.data() + kNumVoices; }
+  };
+
+  VoiceSlots mVoices;
+  std::array<int, kNumVoices> mActiveList{};
+  std::array<bool, kNumVoices> mInActiveList{};
+  std::array<int, kNumVoices> mSlotNote{};
+  std::array<uint16_t, 128> mNoteVoiceCount{};
+  int mActiveCount = 0;
+  std::array<T, kRenderChunkSize> mVoiceScratch{};
+  // Envelope buffers for Voice::ProcessBlock(), shared by the voices
+  // rendered on the audio thread.
+  typename Voice::EnvScratch mEnvScratch;
+  // Ladder batching (kLadderLanes > 1): per-slot output of the last
+  // RenderLadderGroups() and whether the slot was rendered there.
+  std::array<std::array<T, kRenderChunkSize>,
+             (kLadderLanes > 1) ? kNumVoices : 0>
+      mLadderOut{};
+  std::array<bool, kNumVoices> mLadderBatched{};
+  VoiceLayout mVoiceLayout = VoiceLayout::Objects;
+#if POLYSYNTH_VOICE_BANK
+  // Lane arrays of the Bank layout, refilled for every group.
+  VoiceBank mVoiceBank;
+#endif
   sea::VoiceAllocator<Voice, kMaxVoices> mAllocator;
-  sample_t mSampleRate = 44100.0;
+  T mSampleRate = 44100.0;
   uint32_t mGlobalTimestamp = 0;
+  int mControlRate = 1;
+  int mOversampling = 1;
+  bool mOversampleOscillators = false;
 };
 
+using VoiceManager = BasicVoiceManager<sample_t>;
+
 } // namespace PolySynthCore
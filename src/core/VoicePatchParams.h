@@ -0,0 +1,150 @@
+#pragma once
+
+#include "DspConstants.h"
+#include "types.h"
+#include <algorithm>
+#include <cmath>
+#include <sea_dsp/sea_adsr.h>
+#include <sea_dsp/sea_math.h>
+
+namespace PolySynthCore {
+
+enum class VoiceFilterModel { Classic, Ladder, Cascade12, Cascade24 };
+
+// Patch-global voice parameters, including everything derived from them
+// (detune ratio, glide coefficient, envelope increments). VoiceManager owns
+// one block that all of its voices read through a pointer, so a patch change
+// is computed once instead of once per voice. Voices keep only per-note
+// state (oscillator/filter/envelope state, pitch, pan, velocity).
+// T is the voice's audio sample type (see BasicVoice).
+template <typename T>
+struct BasicVoicePatchParams {
+  using EnvCoeffs = typename sea::BasicADSREnvelope<T>::Coefficients;
+
+  T sampleRate = 48000.0;
+
+  // --- Filter ---
+  T baseCutoff = 2000.0;
+  T baseRes = 0.707; // biquad Q (mapped from 0-1 resonance)
+  T filterEnvAmount = 0.0;
+  VoiceFilterModel filterModel = VoiceFilterModel::Ladder;
+
+  // --- Oscillators / mixer ---
+  T mixA = 1.0;
+  T mixB = 0.0;
+  T detuneB = 0.0;
+  T detuneFactor = 1.0; // = pow(2.0, detuneB / 1200.0)
+  T basePulseWidthA = 0.5;
+  T basePulseWidthB = 0.5;
+
+  // --- LFO routing depths ---
+  T lfoPitchDepth = 0.0;
+  T lfoFilterDepth = 0.0;
+  T lfoAmpDepth = 0.0;
+  T lfoPanDepth = 0.0;
+
+  // --- Poly-mod ---
+  T polyModOscBToFreqA = 0.0;
+  T polyModOscBToPWM = 0.0;
+  T polyModOscBToFilter = 0.0;
+  T polyModFilterEnvToFreqA = 0.0;
+  T polyModFilterEnvToPWM = 0.0;
+  T polyModFilterEnvToFilter = 0.0;
+
+  // --- Portamento ---
+  T glideTime = 0.0;
+  T glideAlpha = 1.0; // = 1 - exp(-kGlideTimeConstant / (glideTime * SR))
+
+  // --- Envelopes ---
+  EnvCoeffs ampEnv{};
+  EnvCoeffs filterEnv{};
+
+  // --- Release-tail culling ---
+  T cullThreshold = 0.0; // linear output level; 0 = culling off
+  int cullHoldSamples = 960; // = kReleaseCullHoldSec * SR
+
+  // Restores the defaults a freshly initialised voice starts from. Mixer,
+  // filter env amount, LFO routing and release culling are deliberately kept.
+  void Init(T rate) {
+    sampleRate = rate;
+    cullHoldSamples = std::max(1, static_cast<int>(T(kReleaseCullHoldSec) * rate));
+    detuneFactor = T(sea::Math::Exp2(detuneB / T(1200)));
+    glideTime = T(0);
+    glideAlpha = T(1);
+    basePulseWidthA = T(0.5);
+    basePulseWidthB = T(0.5);
+    baseCutoff = T(2000);
+    baseRes = T(0.707);
+    polyModOscBToFreqA = T(0);
+    polyModOscBToPWM = T(0);
+    polyModOscBToFilter = T(0);
+    polyModFilterEnvToFreqA = T(0);
+    polyModFilterEnvToPWM = T(0);
+    polyModFilterEnvToFilter = T(0);
+    filterModel = VoiceFilterModel::Ladder;
+    ampEnv = EnvCoeffs::Compute(T(0.01), T(0.1), T(1), T(0.2), rate);
+    filterEnv = EnvCoeffs::Compute(T(0.01), T(0.1), T(0.5), T(0.2), rate);
+  }
+
+  void SetGlideTime(T seconds) {
+    glideTime = std::max(T(0.0), seconds);
+    if (glideTime > T(0)) {
+      glideAlpha = T(1) - std::exp(-T(kGlideTimeConstant) / (glideTime * sampleRate));
+    } else {
+      glideAlpha = T(1); // Instant snap
+    }
+  }
+
+  void SetADSR(T a, T d, T s, T r) {
+    ampEnv = EnvCoeffs::Compute(a, d, s, r, sampleRate);
+  }
+
+  void SetFilterEnv(T a, T d, T s, T r) {
+    filterEnv = EnvCoeffs::Compute(a, d, s, r, sampleRate);
+  }
+
+  void SetFilter(T cutoff, T res, T envAmount) {
+    baseCutoff = cutoff;
+    // Map 0-1 resonance to 0.5-20.5 Q for the biquad filter
+    baseRes = T(kResonanceBaseQ) + (res * res * T(kResonanceScale));
+    filterEnvAmount = envAmount;
+  }
+
+  void SetPulseWidthA(T pw) {
+    basePulseWidthA = std::clamp(pw, T(0.01), T(0.99));
+  }
+  void SetPulseWidthB(T pw) {
+    basePulseWidthB = std::clamp(pw, T(0.01), T(0.99));
+  }
+
+  void SetMixer(T a, T b, T detuneCents) {
+    mixA = std::clamp(a, T(0.0), T(1.0));
+    mixB = std::clamp(b, T(0.0), T(1.0));
+    detuneB = detuneCents;
+    detuneFactor = T(sea::Math::Exp2(detuneB / T(1200)));
+  }
+
+  // Threshold in dBFS of voice output below which a releasing voice is
+  // retired early. 0 dB or above disables culling.
+  void SetReleaseCulling(T thresholdDb) {
+    cullThreshold = (thresholdDb < T(0))
+                        ? T(std::pow(T(10), thresholdDb / T(20)))
+                        : T(0);
+  }
+
+  bool HasLfoRouting() const {
+    return lfoPitchDepth != T(0) || lfoFilterDepth != T(0) ||
+           lfoAmpDepth != T(0) || lfoPanDepth != T(0);
+  }
+
+  void SetLFORouting(T pitch, T filter, T amp, T pan) {
+    lfoPitchDepth = pitch;
+    lfoFilterDepth = filter;
+    lfoAmpDepth = amp;
+    lfoPanDepth = pan;
+  }
+};
+
+using VoicePatchParams = BasicVoicePatchParams<sample_t>;
+
+} // namespace PolySynthCore
@@ -0,0 +1,191 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#include <sea_dsp/sea_denormal.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_IX86)
+#include <emmintrin.h>
+#define POLYSYNTH_CPU_RELAX() _mm_pause()
+#elif defined(__aarch64__) || defined(__arm__)
+#define POLYSYNTH_CPU_RELAX() __asm__ __volatile__("yield")
+#else
+#define POLYSYNTH_CPU_RELAX() ((void)0)
+#endif
+
+namespace PolySynthCore {
+
+/// Fixed pool of pre-spawned worker threads for splitting per-block work
+/// (one item per active voice) across cores.
+///
+/// Run() is realtime-safe: no locks, no allocation, no syscalls on the
+/// calling (audio) thread. Items [0, count) are dealt out as contiguous
+/// ranges, one per participant (caller + workers); each participant drains
+/// its own range, then steals from the others' ranges. Claiming is a single
+/// fetch_add on the range cursor, so owners and thieves never conflict.
+///
+/// Workers spin while work is arriving and back off to a short burst of
+/// yield() and then 100 us sleeps, so an idle plugin does not pin cores.
+/// After each Run() a worker stays hot for kSpinIterations pauses plus
+/// kYieldIterations yields (on the order of 0.1-0.3 ms), so between ~1 ms
+/// host blocks a worker spends most of its time asleep; once the host
+/// stops, each worker costs about 10k sleep wake-ups per second (about 5%
+/// of a core measured on x86 Linux). A worker that is asleep
+/// when Run() starts joins up to 100 us late; the caller and the stealing
+/// keep the block correct meanwhile. Start()/Stop() spawn and join threads
+/// and must not be called from the audio thread.
+class VoiceRenderPool {
+public:
+  static constexpr int kMaxWorkers = 15;
+
+  VoiceRenderPool() = default;
+  // Threads are not shared or duplicated: a copy starts out serial.
+  VoiceRenderPool(const VoiceRenderPool &) {}
+  VoiceRenderPool &operator=(const VoiceRenderPool &other) {
+    if (this != &other)
+      Stop();
+    return *this;
+  }
+  ~VoiceRenderPool() { Stop(); }
+
+  /// Spawns numWorkers threads (clamped to [0, kMaxWorkers]). The caller of
+  /// Run() is an extra participant, so total parallelism is numWorkers + 1.
+  void Start(int numWorkers) {
+    Stop();
+    if (numWorkers < 0)
+      numWorkers = 0;
+    if (numWorkers > kMaxWorkers)
+      numWorkers = kMaxWorkers;
+    mQuit.store(false);
+    mNumWorkers = numWorkers;
+    for (int w = 0; w < mNumWorkers; ++w)
+      mThreads[w] = std::thread([this, w] { WorkerLoop(w + 1); });
+  }
+
+  void Stop() {
+    mQuit.store(true);
+    for (int w = 0; w < mNumWorkers; ++w) {
+      if (mThreads[w].joinable())
+        mThreads[w].join();
+    }
+    mNumWorkers = 0;
+  }
+
+  int GetNumWorkers() const { return mNumWorkers; }
+
+  /// Calls fn(item, participant) once for every item in [0, count), spread
+  /// over the caller (participant 0) and the workers (1..GetNumWorkers()),
+  /// and returns when all items are done. fn must be safe to call
+  /// concurrently for distinct items; calls with the same participant
+  /// never overlap, so per-participant scratch needs no locking.
+  template <typename Fn> void Run(int count, Fn &fn) {
+    if (count <= 0)
+      return;
+    if (mNumWorkers == 0 || count == 1) {
+      for (int i = 0; i < count; ++i)
+        fn(i, 0);
+      return;
+    }
+
+    const int participants = mNumWorkers + 1;
+    int begin = 0;
+    for (int p = 0; p < participants; ++p) {
+      const int end = begin + (count - begin) / (participants - p);
+      mRanges[p].next.store(begin, std::memory_order_relaxed);
+      mRanges[p].end = end;
+      begin = end;
+    }
+    mContext = &fn;
+    mInvoke = [](void *ctx, int item, int participant) {
+      (*static_cast<Fn *>(ctx))(item, participant);
+    };
+    mRemaining.store(count, std::memory_order_relaxed);
+
+    // Odd generation = work available. Published after the job so workers
+    // that observe it also observe the ranges and context.
+    const uint32_t gen = mGeneration.load(std::memory_order_relaxed) + 1;
+    mGeneration.store(gen);
+
+    Drain(0);
+    while (mRemaining.load(std::memory_order_acquire) > 0)
+      POLYSYNTH_CPU_RELAX();
+
+    // Even generation = closed. A worker that woke up late re-checks the
+    // generation after announcing itself and backs out; wait for any worker
+    // still inside this generation before the ranges can be reused.
+    mGeneration.store(gen + 1);
+    while (mBusyWorkers.load() > 0)
+      POLYSYNTH_CPU_RELAX();
+  }
+
+private:
+  struct alignas(64) Range {
+    std::atomic<int> next{0};
+    int end = 0;
+  };
+
+  void Drain(int self) {
+    const int participants = mNumWorkers + 1;
+    for (int k = 0; k < participants; ++k) {
+      Range &range = mRanges[(self + k) % participants];
+      for (;;) {
+        const int item = range.next.fetch_add(1, std::memory_order_relaxed);
+        if (item >= range.end)
+          break;
+        mInvoke(mContext, item, self);
+        mRemaining.fetch_sub(1, std::memory_order_release);
+      }
+    }
+  }
+
+  void WorkerLoop(int self) {
+    // FP mode is per thread: match the flush-to-zero the audio thread holds
+    // while it renders (Engine::Process).
+    sea::ScopedFlushDenormals noDenormals;
+    uint32_t seen = mGeneration.load();
+    int idleSpins = 0;
+    while (!mQuit.load(std::memory_order_relaxed)) {
+      const uint32_t gen = mGeneration.load(std::memory_order_acquire);
+      if (gen == seen || (gen & 1u) == 0u) {
+        // Nothing new, or the job already closed: spin, then back off.
+        seen = gen;
+        ++idleSpins;
+        if (idleSpins < kSpinIterations) {
+          POLYSYNTH_CPU_RELAX();
+        } else if (idleSpins < kSpinIterations + kYieldIterations) {
+          std::this_thread::yield();
+        } else {
+          std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+        continue;
+      }
+      seen = gen;
+      idleSpins = 0;
+
+      mBusyWorkers.fetch_add(1);
+      if (mGeneration.load() == gen)
+        Drain(self);
+      mBusyWorkers.fetch_sub(1);
+    }
+  }
+
+  static constexpr int kSpinIterations = 4000;
+  static constexpr int kYieldIterations = 200;
+
+  std::array<std::thread, kMaxWorkers> mThreads;
+  std::array<Range, kMaxWorkers + 1> mRanges;
+  int mNumWorkers = 0;
+  void *mContext = nullptr;
+  void (*mInvoke)(void *, int, int) = nullptr;
+
+  alignas(64) std::atomic<uint32_t> mGeneration{0};
+  alignas(64) std::atomic<int> mRemaining{0};
+  alignas(64) std::atomic<int> mBusyWorkers{0};
+  std::atomic<bool> mQuit{false};
+};
+
+} // namespace PolySynthCore
@@ -23,12 +23,53 @@ constexpr sample_t kPi = static_cast<sample_t>(3.14159265358979323846);
 constexpr sample_t kTwoPi = sample_t(2) * kPi;
 constexpr int kMaxBlockSize = 4096;
 
+// Voices render in sub-blocks of at most this many frames; larger host
+// blocks are split. Keeps the per-engine scratch buffers small enough for
+// embedded SRAM while still amortising per-block setup.
+constexpr int kRenderChunkSize = 64;
+
 // Compile-time voice count — override with -DPOLYSYNTH_MAX_VOICES=N
 #ifndef POLYSYNTH_MAX_VOICES
 #define POLYSYNTH_MAX_VOICES 16
 #endif
 constexpr int kMaxVoices = POLYSYNTH_MAX_VOICES;
 
+// Optional multi-core voice rendering (VoiceManager::SetRenderThreads).
+// Needs std::thread, so it is compiled out on embedded targets.
+#ifndef POLYSYNTH_PARALLEL_VOICES
+#if defined(SEA_PLATFORM_EMBEDDED)
+#define POLYSYNTH_PARALLEL_VOICES 0
+#else
+#define POLYSYNTH_PARALLEL_VOICES 1
+#endif
+#endif
+
+// Structure-of-arrays voice rendering (VoiceManager::SetVoiceLayout). Its
+// lane kernels build on the sea_core oscillator and ADSR, so it is compiled
+// out when either uses the DaisySP backend, and on embedded targets, where
+// the lane buffers cost RAM and a single-lane core gains nothing.
+#ifndef POLYSYNTH_VOICE_BANK
+#if defined(SEA_PLATFORM_EMBEDDED) || defined(SEA_DSP_OSC_BACKEND_DAISYSP) || \
+    defined(SEA_DSP_ADSR_BACKEND_DAISYSP)
+#define POLYSYNTH_VOICE_BANK 0
+#else
+#define POLYSYNTH_VOICE_BANK 1
+#endif
+#endif
+
+// Oscillator and LFO phase accumulators: 32-bit fixed point (wraps by
+// overflow, exact long-term pitch, integer-only adds) instead of the
+// voice's floating-point state type. On by default for embedded, where
+// phase is otherwise single-precision float; override with
+// -DPOLYSYNTH_INTEGER_PHASE=0/1.
+#ifndef POLYSYNTH_INTEGER_PHASE
+#if defined(SEA_PLATFORM_EMBEDDED)
+#define POLYSYNTH_INTEGER_PHASE 1
+#else
+#define POLYSYNTH_INTEGER_PHASE 0
+#endif
+#endif
+
 // Voice lifecycle states
 enum class VoiceState : uint8_t {
   Idle = 0,
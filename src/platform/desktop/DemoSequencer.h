@@ -28,6 +28,8 @@ private:
   template <typename MidiCb, typename UICb>
   void ProcessImpl(int nFrames, double sampleRate, MidiCb&& midiCallback,
                    UICb&& uiCallback);
+  template <typename MidiCb, typename UICb>
+  void EmitStep(int offset, MidiCb& midiCallback, UICb& uiCallback);
 
   Mode mMode = Mode::Off;
   long long mSampleCounter = 0;
@@ -44,50 +46,61 @@ void DemoSequencer::ProcessImpl(int nFrames, double sampleRate,
   long long samplesPerStep = static_cast<long long>(sampleRate * 0.25);
   if (samplesPerStep <= 0)
     return;
-  mSampleCounter += nFrames;
-
-  if (mSampleCounter >= samplesPerStep) {
-    mSampleCounter = 0;
-    mNoteIndex++;
 
-    IMidiMsg msg;
-    if (mMode == Mode::Mono) {
-      const int seq[] = {48, 55, 60, 67};
-      int prevNote = seq[(mNoteIndex - 1 + 4) % 4];
-      int currNote = seq[mNoteIndex % 4];
+  // Steps fire at their exact sample within the block; the emitted messages
+  // carry it in mOffset (see Engine::ScheduleNoteOn). A block longer than a
+  // step fires every step that falls inside it.
+  long long stepAt = samplesPerStep - mSampleCounter;
+  if (stepAt < 0)
+    stepAt = 0;
+  for (; stepAt < nFrames; stepAt += samplesPerStep)
+    EmitStep(static_cast<int>(stepAt), midiCallback, uiCallback);
+  // Samples since the last step, as seen from the end of this block.
+  mSampleCounter = samplesPerStep - (stepAt - nFrames);
+}
 
-      if (mNoteIndex > 0) {
-        msg.MakeNoteOffMsg(prevNote, 0);
-        midiCallback(msg);
-        uiCallback(msg);
-      }
-      msg.MakeNoteOnMsg(currNote, 100, 0);
+template <typename MidiCb, typename UICb>
+void DemoSequencer::EmitStep(int offset, MidiCb& midiCallback,
+                             UICb& uiCallback) {
+  mNoteIndex++;
+
+  IMidiMsg msg;
+  if (mMode == Mode::Mono) {
+    const int seq[] = {48, 55, 60, 67};
+    int prevNote = seq[(mNoteIndex - 1 + 4) % 4];
+    int currNote = seq[mNoteIndex % 4];
+
+    if (mNoteIndex > 0) {
+      msg.MakeNoteOffMsg(prevNote, offset);
       midiCallback(msg);
       uiCallback(msg);
-    } else if (mMode == Mode::Poly || mMode == Mode::FX) {
-      const int chords[4][3] = {
-          {60, 64, 67}, // C
-          {60, 65, 69}, // F
-          {59, 62, 67}, // G
-          {60, 64, 67}  // C
-      };
-
-      int prevIdx = (mNoteIndex - 1 + 4) % 4;
-      int currIdx = mNoteIndex % 4;
-
-      if (mNoteIndex > 0) {
-        for (int i = 0; i < 3; i++) {
-          msg.MakeNoteOffMsg(chords[prevIdx][i], 0);
-          midiCallback(msg);
-          uiCallback(msg);
-        }
-      }
+    }
+    msg.MakeNoteOnMsg(currNote, 100, offset);
+    midiCallback(msg);
+    uiCallback(msg);
+  } else if (mMode == Mode::Poly || mMode == Mode::FX) {
+    const int chords[4][3] = {
+        {60, 64, 67}, // C
+        {60, 65, 69}, // F
+        {59, 62, 67}, // G
+        {60, 64, 67}  // C
+    };
+
+    int prevIdx = (mNoteIndex - 1 + 4) % 4;
+    int currIdx = mNoteIndex % 4;
+
+    if (mNoteIndex > 0) {
       for (int i = 0; i < 3; i++) {
-        msg.MakeNoteOnMsg(chords[currIdx][i], 90, 0);
+        msg.MakeNoteOffMsg(chords[prevIdx][i], offset);
         midiCallback(msg);
         uiCallback(msg);
       }
     }
+    for (int i = 0; i < 3; i++) {
+      msg.MakeNoteOnMsg(chords[currIdx][i], 90, offset);
+      midiCallback(msg);
+      uiCallback(msg);
+    }
   }
 }
 
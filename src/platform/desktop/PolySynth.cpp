@@ -797,21 +797,26 @@ void PolySynthPlugin::OnIdle() {
 }
 void PolySynthPlugin::OnReset() {
   mEngine.Init(GetSampleRate());
+  mEngine.SetReleaseCulling(PolySynthCore::kReleaseCullDesktopDb);
+  mEngine.SetOscillatorAntialias(sea::OscillatorAntialias::PolyBLEP,
+                                 sea::OscillatorAntialias::PolyBLEP);
   mAudioState = mState;
   // Drain any stale queued states
   PolySynthCore::SynthState tmp;
   while (mStateQueue.TryPop(tmp)) {}
   mEngine.UpdateState(mAudioState);
 }
+// Events are queued at their sample offset within the next ProcessBlock()
+// call, so timing is sample-accurate regardless of the host buffer size.
 void PolySynthPlugin::DispatchMidiToEngine(const IMidiMsg &msg) {
   int status = msg.StatusMsg();
   if (status == IMidiMsg::kNoteOn) {
-    mEngine.OnNoteOn(msg.NoteNumber(), msg.Velocity());
+    mEngine.ScheduleNoteOn(msg.mOffset, msg.NoteNumber(), msg.Velocity());
   } else if (status == IMidiMsg::kNoteOff) {
-    mEngine.OnNoteOff(msg.NoteNumber());
+    mEngine.ScheduleNoteOff(msg.mOffset, msg.NoteNumber());
   } else if (status == IMidiMsg::kControlChange) {
     if (msg.mData1 == 64) {
-      mEngine.OnSustainPedal(msg.mData2 >= 64);
+      mEngine.ScheduleSustainPedal(msg.mOffset, msg.mData2 >= 64);
     }
   }
 }
@@ -1082,21 +1087,18 @@ bool PolySynthPlugin::OnMessage(int msgTag, int ctrlTag, int dataSize,
     return false;
   }
 #endif
+  // UI-thread notes go through the UI->audio MIDI queue: ProcessMidiMsg()
+  // schedules them on the audio thread (the engine's event queue is not
+  // thread-safe) and forwards them back to OnMidiMsgUI() for voice tracking.
   else if (msgTag == kMsgTagNoteOn) {
     IMidiMsg msg;
     msg.MakeNoteOnMsg(ctrlTag, 100, 0);
-    DispatchMidiToEngine(msg);
-#if IPLUG_EDITOR
-    OnMidiMsgUI(msg); // routes through plugin voice tracking → OnVoiceOn(slot)
-#endif
+    SendMidiMsgFromUI(msg);
     return true;
   } else if (msgTag == kMsgTagNoteOff) {
     IMidiMsg msg;
     msg.MakeNoteOffMsg(ctrlTag, 0);
-    DispatchMidiToEngine(msg);
-#if IPLUG_EDITOR
-    OnMidiMsgUI(msg); // routes through plugin voice tracking → OnVoiceOff(slot)
-#endif
+    SendMidiMsgFromUI(msg);
     return true;
   }
   return false;
@@ -78,6 +78,7 @@ void PicoSynthApp::Init(float sampleRate) {
     mPendingState.Reset();
     mStagedState.Reset();
     mEngine.Init(static_cast<double>(sampleRate));
+    mEngine.SetReleaseCulling(PolySynthCore::kReleaseCullEmbeddedDb);
     mEngine.UpdateState(mStagedState);
 }
 
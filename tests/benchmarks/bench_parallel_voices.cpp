@@ -0,0 +1,60 @@
+// Voice rendering throughput: single-thread path vs the parallel renderer.
+// Built once per polyphony (bench_parallel_voices_16/_64/_128); every voice
+// is held for the whole run so the measurement is pure voice DSP.
+#include "../../src/core/VoiceManager.h"
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+using namespace PolySynthCore;
+
+namespace {
+constexpr double kSampleRate = 48000.0;
+constexpr double kSeconds = 2.0;
+
+double renderMicros(VoiceManager &vm) {
+  sample_t left[kRenderChunkSize];
+  sample_t right[kRenderChunkSize];
+  const int blocks = static_cast<int>(kSampleRate * kSeconds) / kRenderChunkSize;
+  volatile double sink = 0.0;
+  auto t0 = std::chrono::high_resolution_clock::now();
+  for (int b = 0; b < blocks; ++b) {
+    vm.ProcessStereoBlock(left, right, kRenderChunkSize);
+    sink = sink + static_cast<double>(left[0]);
+  }
+  auto t1 = std::chrono::high_resolution_clock::now();
+  (void)sink;
+  return static_cast<double>(
+      std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count());
+}
+
+double benchThreads(int threads) {
+  VoiceManager vm;
+  vm.Init(kSampleRate);
+  vm.SetFilterModel(static_cast<int>(Voice::FilterModel::Ladder));
+  vm.SetFilter(2000.0, 0.3, 0.4);
+  vm.SetRenderThreads(threads);
+  for (int i = 0; i < kMaxVoices; ++i)
+    vm.OnNoteOn(24 + (i % 84), 100);
+  renderMicros(vm); // warm-up: wakes the workers, faults in the buses
+  return renderMicros(vm);
+}
+} // namespace
+
+int main() {
+  const int cores = static_cast<int>(std::thread::hardware_concurrency());
+  std::printf("%d voices, %.0f s audio, %d hardware threads\n", kMaxVoices,
+              kSeconds, cores);
+  const double serial = benchThreads(1);
+  std::printf("  threads  1: %10.0f us  (%.1fx realtime)\n", serial,
+              kSeconds * 1e6 / serial);
+  const int counts[] = {2, 4, cores};
+  for (int threads : counts) {
+    if (threads <= 1 || threads > VoiceRenderPool::kMaxWorkers + 1)
+      continue;
+    const double t = benchThreads(threads);
+    std::printf("  threads %2d: %10.0f us  (%.1fx realtime, %.2fx vs serial)\n",
+                threads, t, kSeconds * 1e6 / t, serial / t);
+  }
+  return 0;
+}
@@ -0,0 +1,112 @@
+// Voice rendering throughput: one voice at a time (Voice::ProcessBlock, the
+// array-of-structs path) vs lane groups of kLanes ladder voices rendered
+// together (Voice::ProcessLadderBlock, the path VoiceManager takes for
+// Ladder-model voices) vs the structure-of-arrays voice bank
+// (BasicVoiceBank, VoiceManager's VoiceLayout::Bank). Every voice is held
+// for the whole run.
+#include "../../src/core/Voice.h"
+#include "../../src/core/VoiceBank.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+using namespace PolySynthCore;
+
+namespace {
+constexpr double kSampleRate = 48000.0;
+constexpr double kSeconds = 2.0;
+constexpr int kLanes = sea::simd::kLanes<sample_t>;
+
+std::vector<Voice> makeVoices(int count) {
+  std::vector<Voice> voices(static_cast<size_t>(count));
+  for (int i = 0; i < count; ++i) {
+    Voice &v = voices[static_cast<size_t>(i)];
+    v.Init(kSampleRate, static_cast<uint8_t>(i));
+    v.SetFilterModel(Voice::FilterModel::Ladder);
+    v.SetWaveformA(sea::Oscillator::WaveformType::Saw);
+    v.SetWaveformB(sea::Oscillator::WaveformType::Square);
+    v.SetMixer(0.8, 0.5, 7.0);
+    v.SetFilter(1200.0, 0.4, 0.35);
+    v.SetADSR(0.005, 0.05, 0.7, 0.2);
+    v.NoteOn(24 + (i % 84), 100);
+  }
+  return voices;
+}
+
+template <typename RenderFn> double renderMicros(RenderFn &&render) {
+  const int blocks =
+      static_cast<int>(kSampleRate * kSeconds) / kRenderChunkSize;
+  auto t0 = std::chrono::high_resolution_clock::now();
+  for (int b = 0; b < blocks; ++b)
+    render();
+  auto t1 = std::chrono::high_resolution_clock::now();
+  return static_cast<double>(
+      std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count());
+}
+
+void bench(int count) {
+  std::vector<sample_t> mix(kRenderChunkSize);
+  std::vector<std::vector<sample_t>> outs(
+      static_cast<size_t>(count), std::vector<sample_t>(kRenderChunkSize));
+  volatile double sink = 0.0;
+
+  std::vector<Voice> scalar = makeVoices(count);
+  Voice::EnvScratch envScratch;
+  const double aos = renderMicros([&] {
+    for (int v = 0; v < count; ++v)
+      scalar[static_cast<size_t>(v)].ProcessBlock(
+          outs[static_cast<size_t>(v)].data(), kRenderChunkSize, envScratch);
+    sink = sink + static_cast<double>(outs[0][0]);
+  });
+
+  std::vector<Voice> grouped = makeVoices(count);
+  const double lanes = renderMicros([&] {
+    for (int v = 0; v < count; v += kLanes) {
+      Voice *group[kLanes];
+      sample_t *groupOuts[kLanes];
+      const int n = std::min(kLanes, count - v);
+      for (int l = 0; l < n; ++l) {
+        group[l] = &grouped[static_cast<size_t>(v + l)];
+        groupOuts[l] = outs[static_cast<size_t>(v + l)].data();
+      }
+      Voice::ProcessLadderBlock<kLanes>(group, n, groupOuts,
+                                        kRenderChunkSize);
+    }
+    sink = sink + static_cast<double>(outs[0][0]);
+  });
+
+  // A bank group reads one patch block.
+  std::vector<Voice> banked = makeVoices(count);
+  const Voice::PatchParams patch = banked[0].GetPatch();
+  for (Voice &v : banked)
+    v.BindPatch(&patch);
+  BasicVoiceBank<sample_t, sample_t, kLanes> bank;
+  const double soa = renderMicros([&] {
+    for (int v = 0; v < count; v += kLanes) {
+      Voice *group[kLanes];
+      sample_t *groupOuts[kLanes];
+      const int n = std::min(kLanes, count - v);
+      for (int l = 0; l < n; ++l) {
+        group[l] = &banked[static_cast<size_t>(v + l)];
+        groupOuts[l] = outs[static_cast<size_t>(v + l)].data();
+      }
+      bank.Render(group, n, groupOuts, kRenderChunkSize);
+    }
+    sink = sink + static_cast<double>(outs[0][0]);
+  });
+  (void)sink;
+
+  std::printf("  %2d voices: per-voice %8.0f us, lanes %8.0f us (%.2fx), "
+              "bank %8.0f us (%.2fx)\n",
+              count, aos, lanes, aos / lanes, soa, aos / soa);
+}
+} // namespace
+
+int main() {
+  std::printf("%.0f s audio, %d-lane groups of %zu-bit samples\n", kSeconds,
+              kLanes, sizeof(sample_t) * 8);
+  for (int count : {8, 16, 32, 64})
+    bench(count);
+  return 0;
+}
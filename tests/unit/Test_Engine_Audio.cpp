@@ -53,3 +53,54 @@ TEST_CASE("Engine Produces Audio On Note", "[Engine]") {
   engine.Process(nullptr, outputs, 100, 2);
   REQUIRE(left[0] == Approx(0.0).margin(0.001));
 }
+
+TEST_CASE("Engine block Process matches per-sample Process",
+          "[Engine][Block]") {
+  using PolySynthCore::sample_t;
+  PolySynthCore::Engine blockEngine;
+  PolySynthCore::Engine sampleEngine;
+  blockEngine.Init(48000.0);
+  sampleEngine.Init(48000.0);
+
+  PolySynthCore::SynthState state;
+  state.lfoDepth = 1.0f;
+  state.lfoRate = 4.0f;
+  state.polyModOscBToFilter = 0.3f;
+  state.stereoSpread = 0.8f;
+  state.fxChorusMix = 0.3f;
+  state.fxDelayMix = 0.2f;
+  blockEngine.UpdateState(state);
+  sampleEngine.UpdateState(state);
+  // LFO pan modulation forces the per-sample fallback for those voices.
+  blockEngine.SetLFORouting(0.2, 0.3, 0.1, 0.5);
+  sampleEngine.SetLFORouting(0.2, 0.3, 0.1, 0.5);
+
+  const int notes[] = {48, 55, 60, 64, 67};
+  for (int note : notes) {
+    blockEngine.OnNoteOn(note, 100);
+    sampleEngine.OnNoteOn(note, 100);
+  }
+
+  // Host block sizes below, at and above the internal render chunk.
+  const int blockSizes[] = {1, 37, PolySynthCore::kRenderChunkSize, 500};
+  sample_t left[500];
+  sample_t right[500];
+  sample_t *outputs[2] = {left, right};
+  double maxErr = 0.0;
+  for (int pass = 0; pass < 8; ++pass) {
+    if (pass == 4) {
+      blockEngine.OnNoteOff(60);
+      sampleEngine.OnNoteOff(60);
+    }
+    for (int n : blockSizes) {
+      blockEngine.Process(nullptr, outputs, n, 2);
+      for (int i = 0; i < n; ++i) {
+        sample_t l, r;
+        sampleEngine.Process(l, r);
+        maxErr = std::max(maxErr, static_cast<double>(std::abs(left[i] - l)));
+        maxErr = std::max(maxErr, static_cast<double>(std::abs(right[i] - r)));
+      }
+    }
+  }
+  REQUIRE(maxErr <= 1e-9);
+}
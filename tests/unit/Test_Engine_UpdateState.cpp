@@ -214,3 +214,161 @@ TEST_CASE("Engine: filter resonance=1.0 produces no NaN or blow-up",
   bool allFinite = ProcessAndCheckFinite(*engine, kBlockSize * 4);
   REQUIRE(allFinite);
 }
+
+TEST_CASE("Engine: unchanged UpdateState applies no setters",
+          "[Engine][UpdateState]") {
+  auto engine = MakeEngine();
+
+  SynthState state{};
+  engine->UpdateState(state);
+  const uint32_t fullApply = engine->GetStateApplyCount();
+  REQUIRE(fullApply > 0);
+
+  // The per-block steady state: repeated identical states are O(1).
+  for (int block = 0; block < 100; ++block)
+    engine->UpdateState(state);
+  CHECK(engine->GetStateApplyCount() == fullApply);
+
+  // One changed field re-runs exactly its own group.
+  state.filterCutoff = 500.0f;
+  engine->UpdateState(state);
+  CHECK(engine->GetStateApplyCount() == fullApply + 1);
+  state.ampAttack = 0.2f;
+  state.ampRelease = 0.3f;
+  engine->UpdateState(state);
+  CHECK(engine->GetStateApplyCount() == fullApply + 2);
+
+  // Direct setters and Reset() bypass the cache, so the next update is full.
+  engine->SetFilter(3000.0, 0.2, 0.0);
+  engine->UpdateState(state);
+  CHECK(engine->GetStateApplyCount() == 2 * fullApply + 2);
+  engine->Reset();
+  engine->UpdateState(state);
+  CHECK(engine->GetStateApplyCount() == 3 * fullApply + 2);
+}
+
+TEST_CASE("Engine: UpdateState after a direct setter restores the state",
+          "[Engine][UpdateState]") {
+  auto reference = MakeEngine();
+  auto engine = MakeEngine();
+
+  SynthState state{};
+  state.filterCutoff = 400.0f;
+  reference->UpdateState(state);
+  engine->UpdateState(state);
+  engine->SetFilter(8000.0, 0.0, 0.0);
+  engine->UpdateState(state);
+
+  reference->OnNoteOn(48, 127);
+  engine->OnNoteOn(48, 127);
+  const double rmsRef = ProcessAndMeasureRMS(*reference, kBlockSize);
+  const double rms = ProcessAndMeasureRMS(*engine, kBlockSize);
+  REQUIRE(rms == Approx(rmsRef).epsilon(1e-9));
+}
+
+TEST_CASE("Engine: master gain changes ramp linearly over the smoothing time",
+          "[Engine][UpdateState][Smoothing]") {
+  auto reference = MakeEngine();
+  auto engine = MakeEngine();
+  SynthState state{};
+  reference->UpdateState(state);
+  engine->UpdateState(state);
+  reference->OnNoteOn(48, 127);
+  engine->OnNoteOn(48, 127);
+  ProcessAndMeasureRMS(*reference, kBlockSize);
+  ProcessAndMeasureRMS(*engine, kBlockSize);
+
+  const sample_t from = state.masterGain;
+  state.masterGain = 0.0f;
+  engine->UpdateState(state);
+  REQUIRE(engine->IsSmoothing());
+
+  // 20 ms at 44.1 kHz, rounded to whole 16-sample control periods.
+  const int rampSamples =
+      static_cast<int>(kParamSmoothingSec * kSampleRate / kParamSmoothingInterval +
+                       0.5) *
+      kParamSmoothingInterval;
+  // ProcessDiag() skips the FX chain, so the output is voice sum * gain.
+  float peaks[kMaxVoices] = {};
+  double maxErr = 0.0;
+  for (int i = 0; i < rampSamples + 64; ++i) {
+    sample_t refL = 0.0, refR = 0.0, left = 0.0, right = 0.0;
+    reference->ProcessDiag(refL, refR, peaks);
+    engine->ProcessDiag(left, right, peaks);
+    const double g =
+        (i + 1 >= rampSamples)
+            ? 0.0
+            : static_cast<double>(from) * (1.0 - double(i + 1) / rampSamples);
+    const double expected = static_cast<double>(refL) / static_cast<double>(from) * g;
+    maxErr = std::max(maxErr, std::abs(static_cast<double>(left) - expected));
+  }
+  CHECK(maxErr < 1e-4);
+  CHECK_FALSE(engine->IsSmoothing());
+}
+
+TEST_CASE("Engine: smoothing time 0 applies changes immediately",
+          "[Engine][UpdateState][Smoothing]") {
+  auto engine = MakeEngine();
+  engine->SetParamSmoothingTime(0.0);
+  SynthState state{};
+  engine->UpdateState(state);
+  engine->OnNoteOn(60, 127);
+  REQUIRE(ProcessAndMeasureRMS(*engine, kBlockSize) > 0.0);
+
+  state.masterGain = 0.0f;
+  state.filterCutoff = 300.0f;
+  engine->UpdateState(state);
+  CHECK_FALSE(engine->IsSmoothing());
+  float peaks[kMaxVoices] = {};
+  sample_t left = 0.0, right = 0.0;
+  engine->ProcessDiag(left, right, peaks);
+  CHECK(left == sample_t(0));
+  CHECK(right == sample_t(0));
+}
+
+TEST_CASE("Engine: parameter ramps render identically in blocks and per sample",
+          "[Engine][UpdateState][Smoothing]") {
+  SynthState start{};
+  start.fxDelayMix = 0.2f;
+  start.fxChorusMix = 0.1f;
+  SynthState target = start;
+  target.filterCutoff = 9000.0f;
+  target.filterResonance = 0.6f;
+  target.mixOscB = 0.8f;
+  target.fxDelayTime = 0.5f;
+  target.fxDelayFeedback = 0.6f;
+  target.fxDelayMix = 0.7f;
+  target.fxChorusMix = 0.5f;
+  target.masterGain = 0.4f;
+
+  auto blockEngine = MakeEngine();
+  auto sampleEngine = MakeEngine();
+  for (Engine *e : {blockEngine.get(), sampleEngine.get()}) {
+    e->UpdateState(start);
+    e->OnNoteOn(45, 110);
+    e->OnNoteOn(57, 90);
+  }
+
+  constexpr int kHostBlock = 500; // not a multiple of the control interval
+  sample_t blockL[kHostBlock], blockR[kHostBlock];
+  sample_t *outputs[2] = {blockL, blockR};
+  double maxDiff = 0.0;
+  double energy = 0.0;
+  for (int block = 0; block < 8; ++block) {
+    if (block == 1) {
+      blockEngine->UpdateState(target);
+      sampleEngine->UpdateState(target);
+    }
+    blockEngine->Process(nullptr, outputs, kHostBlock, 2);
+    for (int i = 0; i < kHostBlock; ++i) {
+      sample_t l = 0.0, r = 0.0;
+      sampleEngine->Process(l, r);
+      maxDiff = std::max(maxDiff, std::abs(static_cast<double>(l - blockL[i])));
+      maxDiff = std::max(maxDiff, std::abs(static_cast<double>(r - blockR[i])));
+      energy += std::abs(static_cast<double>(l));
+    }
+  }
+  REQUIRE(energy > 1.0);
+  CHECK(maxDiff <= 1e-9);
+  CHECK_FALSE(blockEngine->IsSmoothing());
+}
@@ -0,0 +1,202 @@
+#include "../../src/core/Engine.h"
+#include "../../src/core/EventQueue.h"
+#include "catch.hpp"
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+using namespace PolySynthCore;
+
+namespace {
+constexpr double kSampleRate = 48000.0;
+constexpr int kHostBlock = 1024;
+
+std::unique_ptr<Engine> MakeEngine() {
+  auto engine = std::make_unique<Engine>();
+  engine->Init(kSampleRate);
+  SynthState state;
+  state.ampAttack = 0.001f;
+  state.ampRelease = 0.05f;
+  engine->UpdateState(state);
+  return engine;
+}
+
+// Renders nBlocks host blocks of kHostBlock samples; schedule(engine, block)
+// queues that block's events before it is processed.
+std::vector<sample_t> RenderScheduled(
+    int nBlocks, const std::function<void(Engine &, int)> &schedule) {
+  auto engine = MakeEngine();
+  std::vector<sample_t> left(kHostBlock), right(kHostBlock), out;
+  sample_t *outputs[2] = {left.data(), right.data()};
+  for (int b = 0; b < nBlocks; ++b) {
+    schedule(*engine, b);
+    engine->Process(nullptr, outputs, kHostBlock, 2);
+    out.insert(out.end(), left.begin(), left.end());
+  }
+  return out;
+}
+
+// Per-sample reference: act(engine, n) applies the events due at sample n.
+std::vector<sample_t> RenderReference(
+    int nSamples, const std::function<void(Engine &, int)> &act) {
+  auto engine = MakeEngine();
+  std::vector<sample_t> out;
+  for (int n = 0; n < nSamples; ++n) {
+    act(*engine, n);
+    sample_t l, r;
+    engine->Process(l, r);
+    out.push_back(l);
+  }
+  return out;
+}
+
+double MaxDiff(const std::vector<sample_t> &a, const std::vector<sample_t> &b) {
+  double err = 0.0;
+  for (size_t i = 0; i < a.size() && i < b.size(); ++i)
+    err = std::max(err, static_cast<double>(std::abs(a[i] - b[i])));
+  return err;
+}
+
+double Energy(const std::vector<sample_t> &a) {
+  double e = 0.0;
+  for (sample_t s : a)
+    e += static_cast<double>(std::abs(s));
+  return e;
+}
+} // namespace
+
+TEST_CASE("EventQueue keeps offset order and insertion order for ties",
+          "[EventQueue]") {
+  EventQueue<8> queue;
+  const int offsets[] = {40, 10, 40, 0, 10};
+  for (int i = 0; i < 5; ++i) {
+    SynthEvent e;
+    e.offset = offsets[i];
+    e.note = static_cast<uint8_t>(i);
+    REQUIRE(queue.Push(e));
+  }
+  CHECK(queue.NextOffset(1000) == 0);
+  CHECK(queue.NextOffset(-1) == -1);
+
+  const int expected[] = {3, 1, 4, 0, 2};
+  SynthEvent e;
+  REQUIRE(queue.PopDue(10, e));
+  CHECK(e.note == expected[0]);
+  REQUIRE(queue.PopDue(10, e));
+  CHECK(e.note == expected[1]);
+  REQUIRE(queue.PopDue(10, e));
+  CHECK(e.note == expected[2]);
+  CHECK_FALSE(queue.PopDue(10, e));
+
+  // Remaining events move with the time origin.
+  queue.Advance(32);
+  CHECK(queue.NextOffset(1000) == 8);
+  REQUIRE(queue.PopDue(8, e));
+  CHECK(e.note == expected[3]);
+  REQUIRE(queue.PopDue(8, e));
+  CHECK(e.note == expected[4]);
+  CHECK(queue.Empty());
+}
+
+TEST_CASE("Scheduled notes are sample-accurate in large host blocks",
+          "[Engine][Events]") {
+  // Note on at 300, a second note in the next block, note off at 2600.
+  const auto scheduled = RenderScheduled(4, [](Engine &engine, int block) {
+    if (block == 0) {
+      engine.ScheduleNoteOn(300, 60, 100);
+      engine.ScheduleNoteOn(1100, 67, 90); // past this block: carried over
+    }
+    if (block == 2)
+      engine.ScheduleNoteOff(2600 - 2 * kHostBlock, 60);
+  });
+  const auto reference = RenderReference(4 * kHostBlock, [](Engine &engine, int n) {
+    if (n == 300)
+      engine.OnNoteOn(60, 100);
+    if (n == 1100)
+      engine.OnNoteOn(67, 90);
+    if (n == 2600)
+      engine.OnNoteOff(60);
+  });
+  REQUIRE(Energy(reference) > 1.0);
+  CHECK(MaxDiff(scheduled, reference) <= 1e-9);
+}
+
+TEST_CASE("Scheduled sustain pedal and state changes are sample-accurate",
+          "[Engine][Events]") {
+  SynthState bright;
+  bright.ampAttack = 0.001f;
+  bright.ampRelease = 0.05f;
+  bright.filterCutoff = 8000.0f;
+
+  const auto scheduled = RenderScheduled(3, [&](Engine &engine, int block) {
+    if (block == 0) {
+      engine.ScheduleSustainPedal(0, true);
+      engine.ScheduleNoteOn(100, 48, 110);
+      engine.ScheduleNoteOff(200, 48); // held by the pedal
+      engine.ScheduleState(700, bright);
+      engine.ScheduleSustainPedal(1800, false);
+    }
+  });
+  const auto reference = RenderReference(3 * kHostBlock, [&](Engine &engine, int n) {
+    if (n == 0)
+      engine.OnSustainPedal(true);
+    if (n == 100)
+      engine.OnNoteOn(48, 110);
+    if (n == 200)
+      engine.OnNoteOff(48);
+    if (n == 700)
+      engine.UpdateState(bright);
+    if (n == 1800)
+      engine.OnSustainPedal(false);
+  });
+  REQUIRE(Energy(reference) > 1.0);
+  CHECK(MaxDiff(scheduled, reference) <= 1e-9);
+}
+
+TEST_CASE("Full event queue applies due events before the new one",
+          "[Engine][Events]") {
+  auto engine = MakeEngine();
+  REQUIRE(engine->ScheduleNoteOn(5, 60, 100));
+  for (size_t i = 1; i < Engine::kMaxScheduledEvents; ++i)
+    REQUIRE(engine->ScheduleSustainPedal(2000, false));
+  // The queue is full: the earlier NoteOn must still precede this NoteOff.
+  CHECK_FALSE(engine->ScheduleNoteOff(5, 60));
+  CHECK(engine->GetPendingEventCount() ==
+        static_cast<int>(Engine::kMaxScheduledEvents) - 1);
+
+  std::vector<sample_t> left(kHostBlock), right(kHostBlock);
+  sample_t *outputs[2] = {left.data(), right.data()};
+  for (int b = 0; b < 8; ++b)
+    engine->Process(nullptr, outputs, kHostBlock, 2);
+  CHECK(engine->GetPendingEventCount() == 0);
+  CHECK(engine->GetActiveVoiceCount() == 0); // released, not stuck
+}
+
+TEST_CASE("Full state slots apply queued states before the new one",
+          "[Engine][Events]") {
+  SynthState states[Engine::kMaxScheduledStates + 1];
+  for (int i = 0; i <= Engine::kMaxScheduledStates; ++i) {
+    states[i].ampAttack = 0.001f;
+    states[i].ampRelease = 0.05f;
+    states[i].filterCutoff = 500.0f + 1000.0f * static_cast<float>(i);
+  }
+  const auto scheduled = RenderScheduled(1, [&](Engine &engine, int) {
+    engine.OnNoteOn(48, 110);
+    for (int i = 0; i < Engine::kMaxScheduledStates; ++i)
+      REQUIRE(engine.ScheduleState(10 * (i + 1), states[i]));
+    CHECK_FALSE(engine.ScheduleState(
+        10 * (Engine::kMaxScheduledStates + 1),
+        states[Engine::kMaxScheduledStates]));
+  });
+  // Every queued state was applied, in order, before the newest one.
+  const auto reference = RenderReference(kHostBlock, [&](Engine &engine, int n) {
+    if (n != 0)
+      return;
+    engine.OnNoteOn(48, 110);
+    for (const SynthState &state : states)
+      engine.UpdateState(state);
+  });
+  REQUIRE(Energy(reference) > 1.0);
+  CHECK(MaxDiff(scheduled, reference) <= 1e-9);
+}
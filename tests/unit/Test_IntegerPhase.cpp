@@ -0,0 +1,117 @@
+#include "Voice.h"
+#include "catch.hpp"
+#include <sea_dsp/sea_lfo.h>
+#include <sea_dsp/sea_oscillator.h>
+#include <cmath>
+#include <cstdint>
+
+using namespace PolySynthCore;
+
+namespace {
+constexpr double kSampleRate = 48000.0;
+
+// Signed distance between two phases in cycles, in [-0.5, 0.5).
+double PhaseDistance(double a, double b) {
+  double d = a - b;
+  return d - std::floor(d + 0.5);
+}
+} // namespace
+
+TEST_CASE("Integer phase holds pitch across the MIDI range",
+          "[Oscillator][IntegerPhase]") {
+  // Five seconds of every note: the accumulated phase must land where the
+  // exact frequency puts it, i.e. no drift beyond the increment rounding.
+  constexpr int kSamples = 48000 * 5;
+  constexpr double kMaxCents = 0.01;
+  for (int note = 0; note < 128; ++note) {
+    const double freq = static_cast<double>(kMidiFreqTable[note]);
+    sea::BasicOscillator<sample_t, uint32_t> osc;
+    osc.Init(static_cast<sample_t>(kSampleRate));
+    osc.SetFrequency(kMidiFreqTable[note]);
+    for (int i = 0; i < kSamples; ++i)
+      osc.Process();
+
+    const double cycles = freq * kSamples / kSampleRate;
+    const double err = PhaseDistance(static_cast<double>(osc.GetPhase()),
+                                     cycles - std::floor(cycles));
+    const double cents = 1200.0 * std::log2(1.0 + std::abs(err) / cycles);
+    INFO("note " << note << ": " << err << " cycles, " << cents << " cents");
+    CHECK(cents < kMaxCents);
+  }
+}
+
+TEST_CASE("Integer phase wraps by overflow", "[Oscillator][IntegerPhase]") {
+  // 12 kHz at 48 kHz is exactly 2^30 per sample: four samples per cycle,
+  // back to zero with no residue however long it runs.
+  sea::BasicOscillator<sample_t, uint32_t> osc;
+  osc.Init(static_cast<sample_t>(kSampleRate));
+  osc.SetFrequency(static_cast<sample_t>(12000.0));
+  for (int i = 0; i < 4 * 100000; ++i)
+    osc.Process();
+  CHECK(osc.GetPhase() == sample_t(0));
+  const sample_t expected[4] = {sample_t(-1), sample_t(-0.5), sample_t(0),
+                                sample_t(0.5)};
+  for (sample_t e : expected)
+    CHECK(osc.Process() == e);
+}
+
+TEST_CASE("Integer phase renders the same waveforms as double phase",
+          "[Oscillator][IntegerPhase]") {
+  using Waveform = sea::OscillatorWaveform;
+  using Antialias = sea::OscillatorAntialias;
+  for (Waveform w : {Waveform::Saw, Waveform::Square, Waveform::Triangle,
+                     Waveform::Sine}) {
+    for (Antialias aa : {Antialias::Naive, Antialias::PolyBLEP}) {
+      sea::BasicOscillator<sample_t, uint32_t> fixed;
+      sea::BasicOscillator<sample_t, double> real;
+      fixed.Init(static_cast<sample_t>(kSampleRate));
+      real.Init(static_cast<sample_t>(kSampleRate));
+      fixed.SetWaveform(w);
+      real.SetWaveform(w);
+      fixed.SetAntialias(aa);
+      real.SetAntialias(aa);
+      fixed.SetPulseWidth(static_cast<sample_t>(0.3));
+      real.SetPulseWidth(static_cast<sample_t>(0.3));
+      fixed.SetFrequency(static_cast<sample_t>(311.13));
+      real.SetFrequency(static_cast<sample_t>(311.13));
+
+      // Naive edges may land one sample apart where the two phases round
+      // differently; everywhere else the outputs agree closely.
+      int mismatched = 0;
+      for (int i = 0; i < 4800; ++i) {
+        const double a = static_cast<double>(fixed.Process());
+        const double b = static_cast<double>(real.Process());
+        if (std::abs(a - b) > 1e-3)
+          ++mismatched;
+      }
+      INFO("waveform " << static_cast<int>(w) << " antialias "
+                       << static_cast<int>(aa));
+      CHECK(mismatched <= 2);
+    }
+  }
+}
+
+TEST_CASE("Integer-phase LFO matches a double-phase LFO",
+          "[LFO][IntegerPhase]") {
+  for (int waveform = 0; waveform < 4; ++waveform) {
+    sea::BasicLFO<sample_t, uint32_t> fixed;
+    sea::BasicLFO<sample_t, double> real;
+    fixed.Init(static_cast<sample_t>(kSampleRate));
+    real.Init(static_cast<sample_t>(kSampleRate));
+    fixed.SetWaveform(waveform);
+    real.SetWaveform(waveform);
+    fixed.SetRate(static_cast<sample_t>(5.3));
+    real.SetRate(static_cast<sample_t>(5.3));
+    fixed.SetDepth(sample_t(1));
+    real.SetDepth(sample_t(1));
+    int mismatched = 0;
+    for (int i = 0; i < 48000; ++i) {
+      const double a = static_cast<double>(fixed.Process());
+      const double b = static_cast<double>(real.Process());
+      if (std::abs(a - b) > 1e-3)
+        ++mismatched;
+    }
+    INFO("waveform " << waveform);
+    CHECK(mismatched <= 12);
+  }
+}
@@ -2,6 +2,7 @@
 // See TESTING_GUIDE.md for test patterns and conventions.
 #define CATCH_CONFIG_PREFIX_ALL
 #include "Voice.h"
+#include "VoiceManager.h"
 #include "TestHelpers.h"
 #include "catch.hpp"
 #include <cmath>
@@ -193,3 +194,159 @@ CATCH_TEST_CASE("LFO rate affects modulation speed", "[Voice][LFO]") {
 
     CATCH_CHECK(fastCrossings > slowCrossings);
 }
+
+namespace {
+
+// Renders `frames` of a manager in 64-sample blocks, starting `note` at
+// `noteAt` (if >= 0), and returns the left channel.
+std::vector<sample_t> RenderManager(VoiceManager &vm, int frames, int noteAt) {
+    std::vector<sample_t> out;
+    sample_t left[kRenderChunkSize];
+    sample_t right[kRenderChunkSize];
+    for (int done = 0; done < frames;) {
+        int n = std::min(kRenderChunkSize, frames - done);
+        if (noteAt > done)
+            n = std::min(n, noteAt - done);
+        if (done == noteAt)
+            vm.OnNoteOn(67, 100);
+        vm.ProcessStereoBlock(left, right, n);
+        out.insert(out.end(), left, left + n);
+        done += n;
+    }
+    return out;
+}
+
+void SetupLfoManager(VoiceManager &vm, LfoMode mode) {
+    vm.Init(kSampleRate);
+    vm.SetLFOMode(mode);
+    vm.SetADSR(0.005, 0.1, 0.8, 0.1);
+    vm.SetLFO(0, 4.0, 1.0);
+    vm.SetLFORouting(0.2, 0.4, 0.3, 0.0);
+}
+
+} // namespace
+
+CATCH_TEST_CASE("LFO bus values match a standalone LFO", "[LFO][LfoBus]") {
+    Voice::LfoBus bus;
+    sea::BasicLFO<sample_t, Voice::PhaseT> lfo;
+    bus.Init(kSampleRate);
+    lfo.Init(kSampleRate);
+    for (int shape = 0; shape < 4; ++shape) {
+        bus.SetLFO(shape, 3.0, 0.8);
+        lfo.SetWaveform(shape);
+        lfo.SetRate(3.0);
+        lfo.SetDepth(0.8);
+        for (int block = 0; block < 20; ++block) {
+            bus.Render(kRenderChunkSize, block % 2 == 1);
+            for (int k = 0; k < kRenderChunkSize; ++k)
+                CATCH_REQUIRE(bus.Value(k) == lfo.Process());
+        }
+    }
+}
+
+CATCH_TEST_CASE("Retriggered LFO bus reads match a fresh LFO",
+                "[LFO][LfoBus]") {
+    // Square is left out: its edge can land a sample apart on rounding.
+    for (int shape : {0, 1, 3}) {
+        Voice::LfoBus bus;
+        bus.Init(kSampleRate);
+        bus.SetLFO(shape, 2.7, 1.0);
+        bus.Skip(12345);
+        const auto offset = bus.RetriggerOffset();
+
+        sea::BasicLFO<sample_t, Voice::PhaseT> fresh;
+        fresh.Init(kSampleRate);
+        fresh.SetWaveform(shape);
+        fresh.SetRate(2.7);
+        fresh.SetDepth(1.0);
+        double maxErr = 0.0;
+        for (int block = 0; block < 200; ++block) {
+            bus.Render(kRenderChunkSize, true);
+            for (int k = 0; k < kRenderChunkSize; ++k)
+                maxErr = std::max(maxErr, std::abs(static_cast<double>(
+                                              bus.Rotated(k, offset) -
+                                              fresh.Process())));
+        }
+        CATCH_INFO("shape " << shape);
+        CATCH_CHECK(maxErr < 1e-4);
+    }
+}
+
+CATCH_TEST_CASE("Shared LFO matches per-voice LFOs for voices started together",
+                "[VoiceManager][LFO][LfoBus]") {
+    // Per-voice LFOs of voices started together run in lockstep, so the
+    // shared bus must reproduce them exactly.
+    VoiceManager shared;
+    VoiceManager perVoice;
+    SetupLfoManager(shared, LfoMode::Free);
+    SetupLfoManager(perVoice, LfoMode::PerVoice);
+    for (int note : {48, 55, 60}) {
+        shared.OnNoteOn(note, 100);
+        perVoice.OnNoteOn(note, 100);
+    }
+    const auto a = RenderManager(shared, 9000, -1);
+    const auto b = RenderManager(perVoice, 9000, -1);
+    for (size_t i = 0; i < a.size(); ++i)
+        CATCH_REQUIRE(a[i] == b[i]);
+}
+
+CATCH_TEST_CASE("Retrigger mode restarts the shared LFO at each NoteOn",
+                "[VoiceManager][LFO][LfoBus]") {
+    // A fresh per-voice LFO starts its cycle at the voice's first NoteOn,
+    // which is what Retrigger reproduces from the shared LFO. Free mode
+    // keeps the late voice on the shared phase instead.
+    VoiceManager retrigger;
+    VoiceManager perVoice;
+    VoiceManager free;
+    SetupLfoManager(retrigger, LfoMode::Retrigger);
+    SetupLfoManager(perVoice, LfoMode::PerVoice);
+    SetupLfoManager(free, LfoMode::Free);
+    for (auto *vm : {&retrigger, &perVoice, &free})
+        vm->OnNoteOn(48, 100);
+
+    constexpr int kLateNote = 3001; // mid-block, away from a cycle boundary
+    const auto r = RenderManager(retrigger, 12000, kLateNote);
+    const auto p = RenderManager(perVoice, 12000, kLateNote);
+    const auto f = RenderManager(free, 12000, kLateNote);
+    double retriggerErr = 0.0;
+    double freeErr = 0.0;
+    for (size_t i = 0; i < r.size(); ++i) {
+        retriggerErr = std::max(retriggerErr, std::abs(double(r[i] - p[i])));
+        freeErr = std::max(freeErr, std::abs(double(f[i] - p[i])));
+    }
+    CATCH_CHECK(retriggerErr < 1e-4);
+    CATCH_CHECK(freeErr > 1e-3);
+}
+
+CATCH_TEST_CASE("Shared LFO block and per-sample rendering match",
+                "[VoiceManager][LFO][LfoBus]") {
+    // Pan routing sends the voices through the per-sample fallback.
+    for (double pan : {0.0, 0.5})
+    for (LfoMode mode : {LfoMode::Free, LfoMode::Retrigger}) {
+        VoiceManager block;
+        VoiceManager sample;
+        SetupLfoManager(block, mode);
+        SetupLfoManager(sample, mode);
+        block.SetLFORouting(0.2, 0.4, 0.3, pan);
+        sample.SetLFORouting(0.2, 0.4, 0.3, pan);
+        block.OnNoteOn(48, 100);
+        sample.OnNoteOn(48, 100);
+
+        sample_t left[kRenderChunkSize];
+        sample_t right[kRenderChunkSize];
+        for (int b = 0; b < 100; ++b) {
+            if (b == 37) {
+                block.OnNoteOn(60, 90);
+                sample.OnNoteOn(60, 90);
+            }
+            const int n = (b % 3 == 0) ? 17 : kRenderChunkSize;
+            block.ProcessStereoBlock(left, right, n);
+            for (int i = 0; i < n; ++i) {
+                sample_t l, rr;
+                sample.ProcessStereo(l, rr);
+                CATCH_REQUIRE(left[i] == l);
+                CATCH_REQUIRE(right[i] == rr);
+            }
+        }
+    }
+}
@@ -0,0 +1,113 @@
+// Float audio path regression: BasicEngine<float, ...> against the double
+// golden renders in tests/golden. Only the desktop (double sample_t)
+// configuration reproduces those renders, so only run_tests defines
+// POLYSYNTH_GOLDEN_DIR.
+#include "../../src/core/Engine.h"
+#include "catch.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifdef POLYSYNTH_GOLDEN_DIR
+
+using namespace PolySynthCore;
+
+namespace {
+
+// Reads the 16-bit mono PCM payload of a golden WAV (WavWriter layout).
+std::vector<int16_t> ReadGoldenWav(const std::string &name) {
+  std::vector<int16_t> samples;
+  std::ifstream file(std::string(POLYSYNTH_GOLDEN_DIR) + "/" + name,
+                     std::ios::binary);
+  if (!file)
+    return samples;
+  char header[44];
+  file.read(header, sizeof(header));
+  int16_t pcm = 0;
+  while (file.read(reinterpret_cast<char *>(&pcm), sizeof(pcm)))
+    samples.push_back(pcm);
+  return samples;
+}
+
+// Same quantisation as WavWriter.
+int16_t ToPcm(double sample) {
+  const float s = std::max(-1.0f, std::min(1.0f, static_cast<float>(sample)));
+  return static_cast<int16_t>(s * 32767.0f);
+}
+
+// demo_engine_poly: A4 for 1 s, then 1 s of release, in 512-frame blocks.
+template <typename EngineT> std::vector<int16_t> RenderEnginePolyDemo() {
+  using S = typename EngineT::sample_type;
+  constexpr double kSampleRate = 48000.0;
+  constexpr int kBlock = 512;
+  auto engine = std::make_unique<EngineT>();
+  engine->Init(kSampleRate);
+  engine->OnNoteOn(69, 100);
+
+  std::vector<int16_t> out;
+  S left[kBlock];
+  S right[kBlock];
+  S *outputs[2] = {left, right};
+  auto render = [&](int frames) {
+    for (int done = 0; done < frames;) {
+      const int n = std::min(kBlock, frames - done);
+      engine->Process(nullptr, outputs, n, 2);
+      for (int i = 0; i < n; ++i)
+        out.push_back(ToPcm(static_cast<double>(left[i])));
+      done += n;
+    }
+  };
+  render(static_cast<int>(kSampleRate));
+  engine->OnNoteOff(69);
+  render(static_cast<int>(kSampleRate));
+  return out;
+}
+
+struct PcmDiff {
+  double rms = 0.0; // in full-scale units
+  int maxLsb = 0;
+};
+
+PcmDiff Compare(const std::vector<int16_t> &a, const std::vector<int16_t> &b) {
+  PcmDiff d;
+  double acc = 0.0;
+  for (size_t i = 0; i < a.size(); ++i) {
+    const int diff = int(a[i]) - int(b[i]);
+    d.maxLsb = std::max(d.maxLsb, std::abs(diff));
+    acc += double(diff) * double(diff);
+  }
+  d.rms = std::sqrt(acc / double(a.size())) / 32768.0;
+  return d;
+}
+
+} // namespace
+
+TEST_CASE("Float audio path matches the double golden render",
+          "[Engine][Precision]") {
+  const auto golden = ReadGoldenWav("demo_engine_poly.wav");
+  REQUIRE(!golden.empty());
+
+  // Float audio with double phase/filter state: within a couple of LSBs.
+  const auto mixed = RenderEnginePolyDemo<MixedPrecisionEngine>();
+  REQUIRE(mixed.size() == golden.size());
+  const PcmDiff mixedDiff = Compare(mixed, golden);
+  INFO("mixed RMS diff " << mixedDiff.rms << ", max " << mixedDiff.maxLsb
+                         << " LSB");
+  CHECK(mixedDiff.rms < 1e-5);
+  CHECK(mixedDiff.maxLsb <= 2);
+
+  // All-float: phase rounding accumulates, so allow a looser bound.
+  const auto allFloat = RenderEnginePolyDemo<BasicEngine<float>>();
+  REQUIRE(allFloat.size() == golden.size());
+  const PcmDiff floatDiff = Compare(allFloat, golden);
+  INFO("all-float RMS diff " << floatDiff.rms << ", max " << floatDiff.maxLsb
+                             << " LSB");
+  CHECK(floatDiff.rms < 1e-4);
+}
+
+#endif // POLYSYNTH_GOLDEN_DIR
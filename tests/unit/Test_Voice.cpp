@@ -4,6 +4,8 @@
 #include "VoiceManager.h"
 #include "TestHelpers.h"
 #include "catch.hpp"
+#include <cmath>
+#include <vector>
 
 using namespace PolySynthCore;
 using namespace TestHelpers;
@@ -239,3 +241,554 @@ CATCH_TEST_CASE("8-voice render completes within reasonable time", "[Voice][Perf
     // If we got here without timeout, the performance is acceptable.
     CATCH_CHECK(true);
 }
+
+namespace {
+void configureBusyVoice(Voice& v, Voice::FilterModel model) {
+    v.Init(kSampleRate);
+    v.SetFilterModel(model);
+    v.SetADSR(0.005, 0.05, 0.6, 0.01);
+    v.SetFilterEnv(0.01, 0.05, 0.3, 0.01);
+    v.SetFilter(800.0, 0.6, 0.5);
+    v.SetWaveformA(sea::Oscillator::WaveformType::Square);
+    v.SetWaveformB(sea::Oscillator::WaveformType::Triangle);
+    v.SetMixer(0.8, 0.4, 7.0);
+    v.SetLFO(0, 6.0, 1.0);
+    v.SetLFORouting(0.3, 0.4, 0.2);
+    v.SetPolyModOscBToFreqA(0.1);
+    v.SetPolyModOscBToPWM(0.3);
+    v.SetPolyModOscBToFilter(0.2);
+    v.SetGlideTime(0.05);
+}
+} // namespace
+
+CATCH_TEST_CASE("ProcessBlock matches per-sample Process for every filter model",
+                "[Voice][Block]") {
+    // Block and per-sample paths share the same Tick<>() body, so the
+    // documented tolerance is exact equality; the margin only guards against
+    // compilers contracting the two inlined copies differently (FMA).
+    constexpr double kTolerance = 1e-9;
+    for (int model = 0; model < 4; ++model) {
+        Voice ref, blk;
+        configureBusyVoice(ref, static_cast<Voice::FilterModel>(model));
+        configureBusyVoice(blk, static_cast<Voice::FilterModel>(model));
+        ref.NoteOn(48, 110);
+        blk.NoteOn(48, 110);
+
+        sample_t block[kRenderChunkSize];
+        double maxErr = 0.0;
+        for (int b = 0; b < 200; ++b) {
+            if (b == 20) {
+                // Legato note exercises the glide path mid-stream.
+                ref.NoteOn(55, 90);
+                blk.NoteOn(55, 90);
+            }
+            if (b == 60) {
+                ref.NoteOff();
+                blk.NoteOff();
+            }
+            const int n = 1 + (b * 37) % kRenderChunkSize;
+            blk.ProcessBlock(block, n);
+            for (int i = 0; i < n; ++i) {
+                double err = std::abs(static_cast<double>(block[i] - ref.Process()));
+                maxErr = std::max(maxErr, err);
+            }
+        }
+        CATCH_CHECK(maxErr <= kTolerance);
+        CATCH_CHECK(ref.IsActive() == blk.IsActive());
+    }
+}
+
+CATCH_TEST_CASE("Fixed-pitch ProcessBlock matches per-sample Process",
+                "[Voice][Block]") {
+    // No vibrato, pitch/PWM poly-mod or glide: the block path pre-renders
+    // the oscillators with ProcessBlock(), which must not change a sample.
+    constexpr double kTolerance = 1e-9;
+    for (int model = 0; model < 4; ++model) {
+        Voice ref, blk;
+        for (Voice* v : {&ref, &blk}) {
+            v->Init(kSampleRate);
+            v->SetFilterModel(static_cast<Voice::FilterModel>(model));
+            v->SetWaveformA(sea::Oscillator::WaveformType::Square);
+            v->SetWaveformB(sea::Oscillator::WaveformType::Saw);
+            v->SetPulseWidthA(0.3);
+            v->SetMixer(0.6, 0.4, 7.0);
+            v->SetADSR(0.002, 0.05, 0.6, 0.01);
+            v->SetFilterEnv(0.001, 0.1, 0.3, 0.05);
+            v->SetFilter(900.0, 0.5, 0.5);
+            v->SetLFO(0, 3.0, 1.0);
+            v->SetLFORouting(0.0, 0.3, 0.2); // filter and amp only
+            v->SetPolyModOscBToFilter(0.2);
+            v->NoteOn(45, 100);
+        }
+
+        sample_t block[kRenderChunkSize];
+        double maxErr = 0.0;
+        for (int b = 0; b < 200; ++b) {
+            if (b == 40) {
+                ref.NoteOff();
+                blk.NoteOff();
+            }
+            if (b == 150) {
+                // Re-trigger after the 10 ms release let the voice go idle.
+                ref.NoteOn(64, 80);
+                blk.NoteOn(64, 80);
+            }
+            const int n = 1 + (b * 37) % kRenderChunkSize;
+            blk.ProcessBlock(block, n);
+            for (int i = 0; i < n; ++i) {
+                double err = std::abs(static_cast<double>(block[i] - ref.Process()));
+                maxErr = std::max(maxErr, err);
+            }
+        }
+        CATCH_CHECK(maxErr <= kTolerance);
+        CATCH_CHECK(ref.IsActive() == blk.IsActive());
+    }
+}
+
+CATCH_TEST_CASE("Block-rendered envelopes match per-sample envelopes",
+                "[Voice][Block][Envelope]") {
+    // Held-gate chunks render both envelopes with ADSR ProcessBlock(); a
+    // retrigger mid-decay, a steal and a release must all pick up from the
+    // same envelope state as the per-sample path.
+    Voice ref, blk;
+    for (Voice* v : {&ref, &blk}) {
+        v->Init(kSampleRate);
+        v->SetFilterModel(Voice::FilterModel::Classic);
+        v->SetWaveformA(sea::Oscillator::WaveformType::Saw);
+        v->SetADSR(0.03, 0.08, 0.4, 0.02);
+        v->SetFilterEnv(0.05, 0.2, 0.1, 0.03);
+        v->SetFilter(1200.0, 0.4, 0.6);
+        v->NoteOn(52, 100);
+    }
+    sample_t block[kRenderChunkSize];
+    for (int b = 0; b < 400; ++b) {
+        if (b == 60) {
+            ref.NoteOn(57, 90);
+            blk.NoteOn(57, 90);
+        }
+        if (b == 150) {
+            ref.StartSteal();
+            blk.StartSteal();
+        }
+        if (b == 200) {
+            ref.NoteOn(60, 100);
+            blk.NoteOn(60, 100);
+        }
+        if (b == 330) {
+            ref.NoteOff();
+            blk.NoteOff();
+        }
+        const int n = 1 + (b * 29) % kRenderChunkSize;
+        blk.ProcessBlock(block, n);
+        for (int i = 0; i < n; ++i)
+            CATCH_REQUIRE(block[i] == ref.Process());
+    }
+    CATCH_CHECK(ref.IsActive() == blk.IsActive());
+}
+
+CATCH_TEST_CASE("Lane-batched ladder voices match ProcessBlock",
+                "[Voice][Block][Ladder]") {
+    // ProcessLadderBlock() runs the ladders of up to Lanes voices side by
+    // side; every voice's output must be bit-identical to rendering it
+    // alone, whatever mix of fixed pitch, vibrato, control rate and
+    // stealing the group holds.
+    constexpr int kLanes = 4;
+    Voice ref[kLanes], lane[kLanes];
+    for (int l = 0; l < kLanes; ++l) {
+        for (Voice* v : {&ref[l], &lane[l]}) {
+            v->Init(kSampleRate);
+            v->SetFilterModel(Voice::FilterModel::Ladder);
+            v->SetWaveformA(sea::Oscillator::WaveformType::Square);
+            v->SetWaveformB(sea::Oscillator::WaveformType::Saw);
+            v->SetMixer(0.6, 0.4, 7.0);
+            v->SetADSR(0.002, 0.05, 0.6, 0.01);
+            v->SetFilterEnv(0.001, 0.1, 0.3, 0.05);
+            v->SetFilter(400.0 + 600.0 * l, 0.2 * l, 0.5);
+            v->SetLFO(0, 3.0 + l, 1.0);
+            // Lane 0 has vibrato (no oscillator pre-render); the rest keep
+            // a fixed pitch.
+            v->SetLFORouting(l == 0 ? 0.5 : 0.0, 0.3, 0.2);
+            if (l == 2)
+                v->SetControlRate(16);
+            v->NoteOn(45 + 5 * l, 100);
+        }
+    }
+
+    sample_t expected[kRenderChunkSize];
+    sample_t got[kLanes][kRenderChunkSize];
+    sample_t* outs[kLanes] = {got[0], got[1], got[2], got[3]};
+    Voice* group[kLanes] = {&lane[0], &lane[1], &lane[2], &lane[3]};
+    for (int b = 0; b < 200; ++b) {
+        if (b == 30) {
+            ref[3].StartSteal();
+            lane[3].StartSteal();
+        }
+        if (b == 40) {
+            for (int l = 0; l < kLanes; ++l) {
+                ref[l].NoteOff();
+                lane[l].NoteOff();
+            }
+        }
+        const int n = 1 + (b * 37) % kRenderChunkSize;
+        Voice::ProcessLadderBlock<kLanes>(group, kLanes, outs, n);
+        for (int l = 0; l < kLanes; ++l) {
+            ref[l].ProcessBlock(expected, n);
+            for (int i = 0; i < n; ++i)
+                CATCH_REQUIRE(got[l][i] == expected[i]);
+            CATCH_REQUIRE(ref[l].IsActive() == lane[l].IsActive());
+        }
+    }
+}
+
+CATCH_TEST_CASE("ProcessBlock zero-fills after the voice goes idle", "[Voice][Block]") {
+    Voice v;
+    v.Init(kSampleRate);
+    v.SetADSR(0.0, 0.0, 1.0, 0.0);
+    v.SetFilterEnv(0.0, 0.0, 1.0, 0.0);
+    v.NoteOn(60, 127);
+    v.NoteOff();
+
+    sample_t block[kRenderChunkSize];
+    for (auto& s : block) s = sample_t(1);
+    v.ProcessBlock(block, kRenderChunkSize);
+    CATCH_CHECK(!v.IsActive());
+    for (int i = 1; i < kRenderChunkSize; ++i) {
+        CATCH_CHECK(block[i] == sample_t(0));
+    }
+}
+
+CATCH_TEST_CASE("Control-rate filter modulation stays close to per-sample",
+                "[Voice][ControlRate]") {
+    // Fast filter-envelope sweep plus LFO filter wobble: the worst case for
+    // stepping coefficients.
+    auto configure = [](Voice& v, Voice::FilterModel model, int rate) {
+        v.Init(kSampleRate);
+        v.SetFilterModel(model);
+        v.SetADSR(0.002, 0.1, 0.8, 0.05);
+        v.SetFilterEnv(0.005, 0.05, 0.2, 0.05);
+        v.SetFilter(400.0, 0.1, 0.8);
+        v.SetLFO(0, 6.0, 1.0);
+        v.SetLFORouting(0.0, 0.4, 0.0);
+        v.SetControlRate(rate);
+    };
+
+    const int rates[] = {8, 16, 32};
+    for (int model = 0; model < 4; ++model) {
+        for (int rate : rates) {
+            Voice ref, ctl;
+            configure(ref, static_cast<Voice::FilterModel>(model), 1);
+            configure(ctl, static_cast<Voice::FilterModel>(model), rate);
+            CATCH_REQUIRE(ctl.GetControlRate() == rate);
+            ref.NoteOn(45, 120);
+            ctl.NoteOn(45, 120);
+
+            double errSq = 0.0;
+            double refSq = 0.0;
+            double ctlSq = 0.0;
+            for (int i = 0; i < 24000; ++i) {
+                if (i == 16000) {
+                    ref.NoteOff();
+                    ctl.NoteOff();
+                }
+                const double r = static_cast<double>(ref.Process());
+                const double c = static_cast<double>(ctl.Process());
+                errSq += (r - c) * (r - c);
+                refSq += r * r;
+                ctlSq += c * c;
+            }
+            CATCH_INFO("model " << model << ", rate " << rate);
+            CATCH_REQUIRE(refSq > 0.0);
+            const auto filterModel = static_cast<Voice::FilterModel>(model);
+            if (filterModel == Voice::FilterModel::Classic ||
+                filterModel == Voice::FilterModel::Ladder) {
+                // Waveform error at least 34 dB below the signal.
+                CATCH_CHECK(std::sqrt(errSq / refSq) < 0.02);
+            } else {
+                // The cascade's tanh feedback loop turns any coefficient
+                // difference (even a 2-sample ramp) into a phase drift during
+                // the attack transient, so compare loudness instead.
+                CATCH_CHECK(std::abs(10.0 * std::log10(ctlSq / refSq)) < 0.25);
+            }
+        }
+    }
+}
+
+CATCH_TEST_CASE("Control rate 1 is the per-sample path", "[Voice][ControlRate]") {
+    Voice a, b;
+    a.Init(kSampleRate);
+    b.Init(kSampleRate);
+    b.SetControlRate(16);
+    b.SetControlRate(1);
+    a.SetFilterEnv(0.01, 0.05, 0.3, 0.1);
+    b.SetFilterEnv(0.01, 0.05, 0.3, 0.1);
+    a.SetFilter(500.0, 0.3, 0.6);
+    b.SetFilter(500.0, 0.3, 0.6);
+    a.NoteOn(57, 100);
+    b.NoteOn(57, 100);
+    for (int i = 0; i < 4096; ++i) {
+        CATCH_REQUIRE(a.Process() == b.Process());
+    }
+}
+
+CATCH_TEST_CASE("Control-rate ProcessBlock matches per-sample Process",
+                "[Voice][Block][ControlRate]") {
+    // While the gate is held ProcessBlock() runs each control period through
+    // the filters' ramped ProcessBlock(); the coefficient sequence is the
+    // one ControlRateFilter() applies per sample, so output is bit-identical,
+    // including across the release and a retrigger.
+    for (int model = 0; model < 4; ++model) {
+        for (bool vibrato : {false, true}) {
+            Voice ref, blk;
+            for (Voice* v : {&ref, &blk}) {
+                v->Init(kSampleRate);
+                v->SetFilterModel(static_cast<Voice::FilterModel>(model));
+                v->SetWaveformA(sea::Oscillator::WaveformType::Saw);
+                v->SetADSR(0.002, 0.05, 0.6, 0.01);
+                v->SetFilterEnv(0.001, 0.1, 0.3, 0.05);
+                v->SetFilter(600.0, 0.4, 0.6);
+                v->SetLFO(0, 5.0, 1.0);
+                v->SetLFORouting(vibrato ? 0.3 : 0.0, 0.3, 0.2);
+                v->SetControlRate(16);
+                v->NoteOn(48, 100);
+            }
+
+            sample_t block[kRenderChunkSize];
+            for (int b = 0; b < 200; ++b) {
+                if (b == 40) {
+                    ref.NoteOff();
+                    blk.NoteOff();
+                }
+                if (b == 150) {
+                    ref.NoteOn(60, 90);
+                    blk.NoteOn(60, 90);
+                }
+                const int n = 1 + (b * 37) % kRenderChunkSize;
+                blk.ProcessBlock(block, n);
+                for (int i = 0; i < n; ++i)
+                    CATCH_REQUIRE(block[i] == ref.Process());
+            }
+            CATCH_CHECK(ref.IsActive() == blk.IsActive());
+        }
+    }
+}
+
+CATCH_TEST_CASE("Oversampled ProcessBlock matches per-sample Process",
+                "[Voice][Block][Oversampling]") {
+    // The block path filters whole segments at the higher rate; the
+    // per-sample path resamples one sample at a time. Both run the same
+    // filter-rate sample sequence, so output is bit-identical.
+    struct Mode {
+        int factor;
+        bool oscillators;
+        int controlRate;
+        bool vibrato;
+    };
+    const Mode modes[] = {{2, false, 1, false}, {4, false, 16, false},
+                          {2, true, 16, false}, {4, true, 1, true},
+                          {4, true, 16, false}};
+    for (int model = 0; model < 4; ++model) {
+        for (const Mode& m : modes) {
+            Voice ref, blk;
+            for (Voice* v : {&ref, &blk}) {
+                v->Init(kSampleRate);
+                v->SetFilterModel(static_cast<Voice::FilterModel>(model));
+                v->SetWaveformA(sea::Oscillator::WaveformType::Saw);
+                v->SetWaveformB(sea::Oscillator::WaveformType::Square);
+                v->SetMixer(0.7, 0.3, 5.0);
+                v->SetADSR(0.002, 0.05, 0.6, 0.01);
+                v->SetFilterEnv(0.001, 0.1, 0.3, 0.05);
+                v->SetFilter(700.0, 0.8, 0.6);
+                v->SetLFO(0, 5.0, 1.0);
+                v->SetLFORouting(m.vibrato ? 0.3 : 0.0, 0.3, 0.2);
+                v->SetControlRate(m.controlRate);
+                v->SetOversampling(m.factor, m.oscillators);
+                v->NoteOn(48, 100);
+            }
+            CATCH_REQUIRE(blk.GetOversampling() == m.factor);
+
+            sample_t block[kRenderChunkSize];
+            for (int b = 0; b < 120; ++b) {
+                if (b == 40) {
+                    ref.NoteOff();
+                    blk.NoteOff();
+                }
+                if (b == 90) {
+                    ref.NoteOn(60, 90);
+                    blk.NoteOn(60, 90);
+                }
+                const int n = 1 + (b * 37) % kRenderChunkSize;
+                blk.ProcessBlock(block, n);
+                for (int i = 0; i < n; ++i)
+                    CATCH_REQUIRE(block[i] == ref.Process());
+            }
+            CATCH_CHECK(ref.IsActive() == blk.IsActive());
+        }
+    }
+}
+
+CATCH_TEST_CASE("Oversampled filter tracks the 1x filter delayed by its latency",
+                "[Voice][Oversampling]") {
+    // A linear low-pass well below Nyquist sounds the same at any rate; the
+    // oversampled voice only adds the resampler delay.
+    for (int factor : {2, 4}) {
+        Voice base, os;
+        for (Voice* v : {&base, &os}) {
+            v->Init(kSampleRate);
+            v->SetWaveformA(sea::Oscillator::WaveformType::Saw);
+            v->SetADSR(0.0, 0.0, 1.0, 0.1);
+            v->SetFilterEnv(0.0, 0.0, 0.0, 0.0);
+            v->SetFilterModel(Voice::FilterModel::Classic);
+            v->SetFilter(800.0, 0.3, 0.0);
+            v->NoteOn(45, 127);
+        }
+        os.SetOversampling(factor);
+        const double latency = static_cast<double>(os.GetOversamplingLatency());
+        CATCH_REQUIRE(latency == (factor == 2 ? 15.0 : 18.5));
+
+        constexpr int kN = 8192;
+        std::vector<double> a(kN), b(kN);
+        for (int i = 0; i < kN; ++i) {
+            a[static_cast<size_t>(i)] = static_cast<double>(base.Process());
+            b[static_cast<size_t>(i)] = static_cast<double>(os.Process());
+        }
+        // Compare against the 1x output shifted by the (possibly half-sample)
+        // latency, linearly interpolated.
+        const int whole = static_cast<int>(latency);
+        const double frac = latency - whole;
+        double errSq = 0.0;
+        double refSq = 0.0;
+        for (int i = 4096; i < kN; ++i) {
+            const double r = (1.0 - frac) * a[static_cast<size_t>(i - whole)] +
+                             frac * a[static_cast<size_t>(i - whole - 1)];
+            errSq += (b[static_cast<size_t>(i)] - r) * (b[static_cast<size_t>(i)] - r);
+            refSq += r * r;
+        }
+        CATCH_INFO("factor " << factor << ", error "
+                             << std::sqrt(errSq / refSq));
+        CATCH_CHECK(std::sqrt(errSq / refSq) < 0.05);
+    }
+}
+
+CATCH_TEST_CASE("Shared patch block matches per-voice patch", "[Voice][Patch]") {
+    // A VoiceManager voice reads the shared block; a standalone voice with
+    // the same settings owns its own. Both must render identically, and a
+    // patch edit must reach a note that is already sounding.
+    VoiceManager vm;
+    vm.Init(kSampleRate);
+    Voice v;
+    v.Init(kSampleRate);
+
+    vm.SetFilterModel(static_cast<int>(Voice::FilterModel::Ladder));
+    vm.SetADSR(0.005, 0.05, 0.6, 0.05);
+    vm.SetFilter(900.0, 0.5, 0.4);
+    vm.SetMixer(0.8, 0.6, 9.0);
+    vm.SetPolyModFilterEnvToPWM(0.3);
+    v.SetFilterModel(Voice::FilterModel::Ladder);
+    v.SetADSR(0.005, 0.05, 0.6, 0.05);
+    v.SetFilter(900.0, 0.5, 0.4);
+    v.SetMixer(0.8, 0.6, 9.0);
+    v.SetPolyModFilterEnvToPWM(0.3);
+
+    vm.OnNoteOn(57, 100);
+    v.NoteOn(57, 100);
+    double maxErr = 0.0;
+    for (int i = 0; i < 4000; ++i) {
+        if (i == 2000) {
+            vm.SetFilter(3000.0, 0.2, 0.1);
+            v.SetFilter(3000.0, 0.2, 0.1);
+        }
+        sample_t l, r;
+        vm.ProcessStereo(l, r);
+        const sample_t mono = v.Process();
+        sample_t panL, panR;
+        v.GetPanCoefficients(panL, panR);
+        maxErr = std::max(maxErr, static_cast<double>(std::abs(
+                                      l - mono * panL * VoiceManager::kHeadroomScale)));
+    }
+    CATCH_CHECK(maxErr < 1e-12);
+
+    // Copies own their patch: editing the copy leaves the original alone.
+    Voice copy = v;
+    copy.SetFilter(200.0, 0.0, 0.0);
+    CATCH_CHECK(v.GetPatch().baseCutoff == sample_t(3000));
+    CATCH_CHECK(copy.GetPatch().baseCutoff == sample_t(200));
+}
+
+CATCH_TEST_CASE("Release culling retires a voice held open by the filter envelope",
+                "[Voice][Culling]") {
+    auto setup = [](Voice &v) {
+        v.Init(kSampleRate);
+        v.SetADSR(0.001, 0.05, 0.8, 0.01);
+        v.SetFilterEnv(0.001, 0.05, 0.5, 5.0); // filter release outlasts amp
+        v.NoteOn(60, 127);
+        processNSamples(v, 4800);
+        v.NoteOff();
+    };
+    Voice plain;
+    setup(plain);
+    Voice culled;
+    culled.SetReleaseCulling(-120.0);
+    setup(culled);
+
+    // Amp release (10 ms) + hold (20 ms) is well under 100 ms.
+    processNSamples(plain, 4800);
+    processNSamples(culled, 4800);
+    CATCH_CHECK(plain.IsActive());
+    CATCH_CHECK_FALSE(culled.IsActive());
+    CATCH_CHECK(culled.GetVoiceState() == VoiceState::Idle);
+}
+
+CATCH_TEST_CASE("Release culling only cuts a tail that stayed below threshold",
+                "[Voice][Culling]") {
+    Voice v;
+    v.Init(kSampleRate);
+    v.SetReleaseCulling(-20.0); // high, so the cut lands well inside the release
+    v.SetADSR(0.001, 0.05, 1.0, 0.5);
+    v.SetFilter(800.0, 0.9, 0.0); // resonant, so the tail rings
+    v.NoteOn(45, 127);
+    processNSamples(v, 4800);
+    v.NoteOff();
+
+    const double threshold = std::pow(10.0, -20.0 / 20.0);
+    const int hold = v.GetPatch().cullHoldSamples;
+    std::vector<double> tail;
+    while (v.IsActive() && tail.size() < static_cast<size_t>(kSampleRate)) {
+        tail.push_back(std::abs(static_cast<double>(v.Process())));
+    }
+    CATCH_REQUIRE_FALSE(v.IsActive());
+    // Retired before the 0.5 s linear release ran out...
+    CATCH_CHECK(tail.size() < static_cast<size_t>(0.5 * kSampleRate));
+    // ...and only after a full hold period of sub-threshold output.
+    CATCH_REQUIRE(tail.size() >= static_cast<size_t>(hold));
+    for (size_t i = tail.size() - static_cast<size_t>(hold); i < tail.size(); ++i)
+        CATCH_CHECK(tail[i] < threshold);
+}
+
+CATCH_TEST_CASE("Release culling resets the envelopes for the next note",
+                "[Voice][Culling]") {
+    Voice v;
+    v.Init(kSampleRate);
+    v.SetReleaseCulling(-20.0); // cut while the release is still well above 0
+    v.SetADSR(0.1, 0.05, 1.0, 0.5);
+    v.NoteOn(45, 127);
+    processNSamples(v, 9600);
+    v.NoteOff();
+    for (int i = 0; i < static_cast<int>(kSampleRate) && v.IsActive(); ++i)
+        v.Process();
+    CATCH_REQUIRE_FALSE(v.IsActive());
+
+    // The 0.1 s attack restarts from zero, not from the culled release level.
+    v.NoteOn(45, 127);
+    v.Process();
+    CATCH_CHECK(v.GetRenderState().amplitude < 0.001f);
+}
+
+CATCH_TEST_CASE("Release culling never cuts a held note", "[Voice][Culling]") {
+    Voice v;
+    v.Init(kSampleRate);
+    v.SetReleaseCulling(-60.0);
+    v.SetADSR(0.001, 0.01, 0.0, 0.1); // decays to silence while held
+    v.NoteOn(60, 127);
+    processNSamples(v, 9600);
+    CATCH_CHECK(v.IsActive());
+}
@@ -0,0 +1,167 @@
+// Structure-of-arrays voice bank (VoiceBank.h) and VoiceLayout::Bank.
+#define CATCH_CONFIG_PREFIX_ALL
+#include "VoiceBank.h"
+#include "VoiceManager.h"
+#include "catch.hpp"
+#include <cmath>
+
+using namespace PolySynthCore;
+
+namespace {
+constexpr double kSampleRate = 48000.0;
+} // namespace
+
+#if POLYSYNTH_VOICE_BANK
+CATCH_TEST_CASE("Voice bank matches ProcessBlock", "[VoiceBank]") {
+    // The bank renders a group from per-field lane arrays; every voice's
+    // output and state must be bit-identical to rendering it alone, across
+    // waveforms, antialiasing, partial and inactive lanes, release and
+    // retirement mid-block.
+    using Osc = sea::Oscillator;
+    constexpr int kLanes = 4;
+    constexpr int kVoices = 3; // one lane left empty
+    const Osc::WaveformType waves[] = {
+        Osc::WaveformType::Saw, Osc::WaveformType::Square,
+        Osc::WaveformType::Triangle, Osc::WaveformType::Sine};
+    for (Osc::WaveformType wave : waves) {
+        for (auto aa : {sea::OscillatorAntialias::Naive,
+                        sea::OscillatorAntialias::PolyBLEP}) {
+            Voice patchOwner;
+            patchOwner.Init(kSampleRate);
+            patchOwner.SetFilterModel(Voice::FilterModel::Ladder);
+            patchOwner.SetMixer(0.6, 0.4, 7.0);
+            patchOwner.SetPulseWidthA(0.3);
+            patchOwner.SetADSR(0.002, 0.03, 0.6, 0.01);
+            patchOwner.SetFilterEnv(0.001, 0.02, 0.3, 0.004);
+            patchOwner.SetFilter(700.0, 0.5, 0.4);
+            const Voice::PatchParams &patch = patchOwner.GetPatch();
+
+            Voice ref[kVoices], banked[kVoices];
+            for (int l = 0; l < kVoices; ++l) {
+                for (Voice *v : {&ref[l], &banked[l]}) {
+                    v->BindPatch(&patch);
+                    v->Init(kSampleRate, static_cast<uint8_t>(l));
+                    v->SetWaveformA(wave);
+                    v->SetWaveformB(wave);
+                    v->SetAntialiasA(aa);
+                    v->SetAntialiasB(aa);
+                    // Lane 1 starts idle and only plays from block 20.
+                    if (l != 1)
+                        v->NoteOn(45 + 7 * l, 60 + 30 * l);
+                }
+            }
+
+            BasicVoiceBank<sample_t, sample_t, kLanes> bank;
+            sample_t expected[kRenderChunkSize];
+            sample_t got[kVoices][kRenderChunkSize];
+            sample_t *outs[kVoices] = {got[0], got[1], got[2]};
+            Voice *group[kVoices] = {&banked[0], &banked[1], &banked[2]};
+            for (int b = 0; b < 120; ++b) {
+                if (b == 20) {
+                    ref[1].NoteOn(50, 90);
+                    banked[1].NoteOn(50, 90);
+                }
+                if (b == 40 || b == 70) {
+                    for (int l = 0; l < kVoices; ++l) {
+                        ref[l].NoteOff();
+                        banked[l].NoteOff();
+                    }
+                }
+                if (b == 60) {
+                    ref[2].NoteOn(62, 110);
+                    banked[2].NoteOn(62, 110);
+                }
+                for (int l = 0; l < kVoices; ++l)
+                    CATCH_REQUIRE(BasicVoiceBank<sample_t, sample_t,
+                                                 kLanes>::CanRender(banked[l]));
+                const int n = 1 + (b * 37) % kRenderChunkSize;
+                bank.Render(group, kVoices, outs, n);
+                for (int l = 0; l < kVoices; ++l) {
+                    ref[l].ProcessBlock(expected, n);
+                    for (int i = 0; i < n; ++i)
+                        CATCH_REQUIRE(got[l][i] == expected[i]);
+                    CATCH_REQUIRE(ref[l].IsActive() == banked[l].IsActive());
+                    CATCH_REQUIRE(ref[l].GetAge() == banked[l].GetAge());
+                }
+            }
+            for (int l = 0; l < kVoices; ++l)
+                CATCH_CHECK(!banked[l].IsActive());
+        }
+    }
+}
+
+CATCH_TEST_CASE("Voice bank declines voices it cannot render", "[VoiceBank]") {
+    using Bank = BasicVoiceBank<sample_t, sample_t, 2>;
+    Voice v;
+    v.Init(kSampleRate);
+    v.SetFilterModel(Voice::FilterModel::Ladder);
+    v.NoteOn(60, 100);
+    CATCH_CHECK(Bank::CanRender(v));
+
+    v.SetLFORouting(0.0, 0.3, 0.0);
+    CATCH_CHECK(!Bank::CanRender(v));
+    v.SetLFORouting(0.0, 0.0, 0.0);
+    v.SetControlRate(16);
+    CATCH_CHECK(!Bank::CanRender(v));
+    v.SetControlRate(1);
+    v.SetPolyModOscBToFilter(0.5);
+    CATCH_CHECK(!Bank::CanRender(v));
+    v.SetPolyModOscBToFilter(0.0);
+    v.SetFilterModel(Voice::FilterModel::Cascade24);
+    CATCH_CHECK(!Bank::CanRender(v));
+}
+#endif // POLYSYNTH_VOICE_BANK
+
+CATCH_TEST_CASE("VoiceManager bank layout renders the same mix",
+                "[VoiceBank][VoiceManager]") {
+    // Switching layouts, even mid-note, must not change a sample.
+    VoiceManager objects;
+    VoiceManager bank;
+    for (VoiceManager *vm : {&objects, &bank}) {
+        vm->Init(kSampleRate);
+        vm->SetFilterModel(static_cast<int>(Voice::FilterModel::Ladder));
+        vm->SetADSR(0.002, 0.05, 0.7, 0.02);
+        vm->SetFilterEnv(0.001, 0.1, 0.3, 0.05);
+        vm->SetFilter(800.0, 0.6, 0.5);
+        for (int i = 0; i < 7; ++i)
+            vm->OnNoteOn(40 + 3 * i, 60 + 8 * i);
+    }
+    bank.SetVoiceLayout(VoiceLayout::Bank);
+    CATCH_CHECK(bank.GetVoiceLayout() == VoiceLayout::Bank);
+    CATCH_CHECK(objects.GetVoiceLayout() == VoiceLayout::Objects);
+
+    sample_t left[kRenderChunkSize], right[kRenderChunkSize];
+    sample_t refLeft[kRenderChunkSize], refRight[kRenderChunkSize];
+    for (int b = 0; b < 150; ++b) {
+        if (b == 30) {
+            objects.OnNoteOff(43);
+            bank.OnNoteOff(43);
+        }
+        if (b == 60) {
+            // A control rate above 1 keeps the voices on the object path.
+            objects.SetControlRate(8);
+            bank.SetControlRate(8);
+        }
+        if (b == 80) {
+            objects.SetControlRate(1);
+            bank.SetControlRate(1);
+        }
+        if (b == 100) {
+            bank.SetVoiceLayout(VoiceLayout::Objects);
+        }
+        if (b == 110) {
+            bank.SetVoiceLayout(VoiceLayout::Bank);
+            for (int i = 0; i < 7; ++i) {
+                objects.OnNoteOff(40 + 3 * i);
+                bank.OnNoteOff(40 + 3 * i);
+            }
+        }
+        objects.ProcessStereoBlock(refLeft, refRight, kRenderChunkSize);
+        bank.ProcessStereoBlock(left, right, kRenderChunkSize);
+        for (int i = 0; i < kRenderChunkSize; ++i) {
+            CATCH_REQUIRE(left[i] == refLeft[i]);
+            CATCH_REQUIRE(right[i] == refRight[i]);
+        }
+    }
+    CATCH_CHECK(bank.GetActiveVoiceCount() == objects.GetActiveVoiceCount());
+}
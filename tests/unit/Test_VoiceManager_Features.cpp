@@ -92,3 +92,220 @@ TEST_CASE("VoiceManager Stereo Spread", "[VoiceManager]") {
     CHECK(absPanningSum > 0.1f);
   }
 }
+
+TEST_CASE("VoiceManager active-voice list tracks note lifecycle",
+          "[VoiceManager]") {
+  VoiceManager vm;
+  vm.Init(48000.0);
+  vm.SetADSR(0.001, 0.01, 1.0, 0.005);
+  vm.SetFilterEnv(0.001, 0.01, 0.5, 0.005);
+
+  sample_t left[kRenderChunkSize];
+  sample_t right[kRenderChunkSize];
+  auto renderMs = [&](int ms) {
+    for (int n = 0; n < ms * 48 / kRenderChunkSize + 1; ++n)
+      vm.ProcessStereoBlock(left, right, kRenderChunkSize);
+  };
+
+  SECTION("NoteOn/NoteOff and idle transitions update count and note map") {
+    vm.OnNoteOn(60, 100);
+    vm.OnNoteOn(64, 100);
+    REQUIRE(vm.GetActiveVoiceCount() == 2);
+    REQUIRE(vm.IsNoteActive(60));
+    REQUIRE(vm.IsNoteActive(64));
+    REQUIRE_FALSE(vm.IsNoteActive(67));
+
+    vm.OnNoteOff(60);
+    renderMs(50);
+    CHECK(vm.GetActiveVoiceCount() == 1);
+    CHECK_FALSE(vm.IsNoteActive(60));
+    CHECK(vm.IsNoteActive(64));
+
+    std::array<int, kMaxVoices> held{};
+    REQUIRE(vm.GetHeldNotes(held) == 1);
+    CHECK(held[0] == 64);
+
+    vm.OnNoteOff(64);
+    renderMs(50);
+    CHECK(vm.GetActiveVoiceCount() == 0);
+    CHECK(vm.GetHeldNotes(held) == 0);
+  }
+
+  SECTION("Stealing moves the slot to the new note") {
+    for (int i = 0; i < kMaxVoices; ++i)
+      vm.OnNoteOn(40 + i, 100);
+    REQUIRE(vm.GetActiveVoiceCount() == kMaxVoices);
+
+    vm.OnNoteOn(100, 100); // steals the oldest voice (note 40)
+    CHECK(vm.GetActiveVoiceCount() == kMaxVoices);
+    CHECK(vm.IsNoteActive(100));
+    CHECK_FALSE(vm.IsNoteActive(40));
+  }
+
+  SECTION("Unison voices share one note entry until all go idle") {
+    vm.SetUnisonCount(3);
+    vm.OnNoteOn(60, 100);
+    REQUIRE(vm.GetActiveVoiceCount() == std::min(3, kMaxVoices));
+    vm.OnNoteOff(60);
+    CHECK(vm.IsNoteActive(60)); // still releasing
+    renderMs(50);
+    CHECK(vm.GetActiveVoiceCount() == 0);
+    CHECK_FALSE(vm.IsNoteActive(60));
+  }
+
+  SECTION("Reset clears the active list") {
+    vm.OnNoteOn(60, 100);
+    vm.Reset();
+    CHECK(vm.GetActiveVoiceCount() == 0);
+    CHECK_FALSE(vm.IsNoteActive(60));
+  }
+}
+
+TEST_CASE("VoiceManager block render of ladder voices matches per-sample",
+          "[VoiceManager][Ladder]") {
+  // ProcessStereoBlock() batches ladder voices across SIMD lanes; the mix
+  // must be what ProcessStereo() renders one voice at a time.
+  VoiceManager ref;
+  VoiceManager blk;
+  for (VoiceManager *vm : {&ref, &blk}) {
+    vm->Init(48000.0);
+    vm->SetFilterModel(static_cast<int>(Voice::FilterModel::Ladder));
+    vm->SetADSR(0.002, 0.05, 0.7, 0.02);
+    vm->SetFilterEnv(0.001, 0.1, 0.3, 0.05);
+    vm->SetFilter(800.0, 0.6, 0.5);
+    for (int i = 0; i < 7; ++i)
+      vm->OnNoteOn(40 + 3 * i, 60 + 8 * i);
+  }
+
+  sample_t left[kRenderChunkSize];
+  sample_t right[kRenderChunkSize];
+  double maxErr = 0.0;
+  for (int b = 0; b < 100; ++b) {
+    if (b == 50) {
+      ref.OnNoteOff(43);
+      blk.OnNoteOff(43);
+    }
+    blk.ProcessStereoBlock(left, right, kRenderChunkSize);
+    for (int i = 0; i < kRenderChunkSize; ++i) {
+      sample_t l = 0, r = 0;
+      ref.ProcessStereo(l, r);
+      maxErr = std::max(maxErr, std::abs(static_cast<double>(left[i] - l)));
+      maxErr = std::max(maxErr, std::abs(static_cast<double>(right[i] - r)));
+    }
+  }
+  CHECK(maxErr <= 1e-9);
+  CHECK(ref.GetActiveVoiceCount() == blk.GetActiveVoiceCount());
+}
+
+TEST_CASE("VoiceManager oversampling survives a copy and returns to 1x",
+          "[VoiceManager][Oversampling]") {
+  // The voices' resampler state lives in the manager only while
+  // oversampling is on; a copy must get its own and render the same.
+  VoiceManager vm;
+  vm.Init(48000.0);
+  vm.SetFilterModel(static_cast<int>(Voice::FilterModel::Ladder));
+  vm.SetFilter(900.0, 0.7, 0.0);
+  vm.SetOversampling(2);
+  REQUIRE(vm.GetOversampling() == 2);
+  CHECK(vm.GetOversamplingLatency() > 0.0);
+  for (int i = 0; i < 4; ++i)
+    vm.OnNoteOn(45 + 5 * i, 100);
+
+  sample_t left[kRenderChunkSize];
+  sample_t right[kRenderChunkSize];
+  for (int b = 0; b < 10; ++b)
+    vm.ProcessStereoBlock(left, right, kRenderChunkSize);
+
+  VoiceManager copy(vm);
+  sample_t copyLeft[kRenderChunkSize];
+  sample_t copyRight[kRenderChunkSize];
+  double peak = 0.0;
+  for (int b = 0; b < 10; ++b) {
+    vm.ProcessStereoBlock(left, right, kRenderChunkSize);
+    copy.ProcessStereoBlock(copyLeft, copyRight, kRenderChunkSize);
+    for (int i = 0; i < kRenderChunkSize; ++i) {
+      REQUIRE(left[i] == copyLeft[i]);
+      REQUIRE(right[i] == copyRight[i]);
+      peak = std::max(peak, std::abs(static_cast<double>(left[i])));
+    }
+  }
+  CHECK(peak > 0.01);
+
+  vm.SetOversampling(1);
+  CHECK(vm.GetOversampling() == 1);
+  CHECK(vm.GetOversamplingLatency() == 0.0);
+  vm.ProcessStereoBlock(left, right, kRenderChunkSize);
+}
+
+TEST_CASE("VoiceManager filter tables stay close to exact coefficients",
+          "[VoiceManager][CutoffTable]") {
+  for (int model = 0; model < 4; ++model) {
+    VoiceManager exact;
+    VoiceManager table;
+    table.SetFilterTables(true);
+    for (VoiceManager *vm : {&exact, &table}) {
+      vm->Init(48000.0); // the table setting survives Init()
+      vm->SetFilterModel(model);
+      vm->SetADSR(0.002, 0.05, 0.7, 0.02);
+      // Fast filter envelope: the cutoff moves every sample.
+      vm->SetFilterEnv(0.05, 0.2, 0.2, 0.05);
+      vm->SetFilter(300.0, 0.4, 0.8);
+      for (int i = 0; i < 4; ++i)
+        vm->OnNoteOn(45 + 7 * i, 100);
+    }
+    REQUIRE(table.GetFilterTables());
+    REQUIRE_FALSE(exact.GetFilterTables());
+
+    sample_t el[kRenderChunkSize], er[kRenderChunkSize];
+    sample_t tl[kRenderChunkSize], tr[kRenderChunkSize];
+    double maxErr = 0.0;
+    double peak = 0.0;
+    double exactEnergy = 0.0;
+    double tableEnergy = 0.0;
+    for (int b = 0; b < 150; ++b) {
+      exact.ProcessStereoBlock(el, er, kRenderChunkSize);
+      table.ProcessStereoBlock(tl, tr, kRenderChunkSize);
+      for (int i = 0; i < kRenderChunkSize; ++i) {
+        const double e = static_cast<double>(el[i]);
+        const double t = static_cast<double>(tl[i]);
+        peak = std::max(peak, std::abs(e));
+        maxErr = std::max(maxErr, std::abs(t - e));
+        exactEnergy += e * e;
+        tableEnergy += t * t;
+      }
+    }
+    INFO("model " << model << ": max error " << maxErr << ", peak " << peak
+                  << ", energy " << exactEnergy << " vs " << tableEnergy);
+    CHECK(peak > 0.05);
+    if (model == 2 || model == 3) {
+      // The Cascade models self-oscillate through their tanh feedback, so
+      // any coefficient difference grows into a phase drift; compare level.
+      CHECK(tableEnergy == Approx(exactEnergy).epsilon(0.05));
+    } else {
+      CHECK(maxErr < 2e-3 * peak);
+    }
+  }
+}
+
+TEST_CASE("VoiceManager release culling frees voice slots early",
+          "[VoiceManager][Culling]") {
+  auto run = [](bool cull) {
+    VoiceManager vm;
+    vm.Init(48000.0);
+    if (cull)
+      vm.SetReleaseCulling(-120.0);
+    vm.SetADSR(0.001, 0.05, 0.8, 0.02);
+    vm.SetFilterEnv(0.001, 0.05, 0.5, 4.0);
+    vm.OnNoteOn(60, 100);
+    vm.OnNoteOn(64, 100);
+    for (int i = 0; i < 4800; ++i)
+      vm.Process();
+    vm.OnNoteOff(60);
+    vm.OnNoteOff(64);
+    for (int i = 0; i < 9600; ++i)
+      vm.Process();
+    return vm.GetActiveVoiceCount();
+  };
+  REQUIRE(run(false) == 2);
+  REQUIRE(run(true) == 0);
+}